@@ -1,12 +1,11 @@
 
-/*
-	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
 */
 
 // SelfiePrint include.
 #include "window.hpp"
-#include "image_list.hpp"
 
 // Qt include.
 #include <QApplication>
@@ -16,12 +15,12 @@
 #include <QDir>
 #include <QStandardPaths>
 #include <QFutureWatcher>
-#include <QImage>
 #include <QtConcurrent>
 #include <QFuture>
 
 // QtMWidgets include.
 #include <QtMWidgets/ListModel>
+#include <QtMWidgets/ImageListView>
 
 
 //
@@ -34,28 +33,19 @@ public:
 		:	q( parent )
 		,	stack( 0 )
 		,	imageList( 0 )
-		,	futureWatcher( 0 )
 		,	filesFutureWatcher( 0 )
 	{
 	}
 
 	//! Init.
 	void init();
-	//!Load images.
-	void loadImages();
 
 	//! Parent.
 	Window * q;
 	//! Stacked widget.
 	QStackedWidget * stack;
 	//! List of images.
-	ImageList * imageList;
-	//! Image files.
-	QStringList imageFiles;
-	//! Load images future watcher.
-	QFutureWatcher< QImage > * futureWatcher;
-	//! Future.
-	QFuture< QImage > future;
+	QtMWidgets::ImageListView * imageList;
 	//! Files future.
 	QFuture< QStringList > fileFuture;
 	//! Files future watcher.
@@ -74,44 +64,12 @@ WindowPrivate::init()
 	stack = new QStackedWidget( q );
 	l->addWidget( stack );
 
-	futureWatcher = new QFutureWatcher< QImage > ( q );
-
-	QObject::connect( futureWatcher, &QFutureWatcher< QImage >::finished,
-		q, &Window::_q_imageLoaded );
-
 	filesFutureWatcher = new QFutureWatcher< QStringList > ( q );
 
 	QObject::connect( filesFutureWatcher, &QFutureWatcher< QStringList >::finished,
 		q, &Window::_q_filesFound );
 }
 
-QImage loadImage( const QString & fileName, const QSize & maxSize )
-{
-	QImage image( fileName );
-
-	if( !image.isNull() )
-	{
-		image = image.scaled( maxSize, Qt::KeepAspectRatio,
-			Qt::SmoothTransformation );
-	}
-
-	return image;
-}
-
-void
-WindowPrivate::loadImages()
-{
-	if( !imageFiles.isEmpty() )
-	{
-		future = QtConcurrent::run( loadImage,
-			imageFiles.at( 0 ),
-			imageList->maxImageSize() );
-		futureWatcher->setFuture( future );
-
-		imageFiles.removeFirst();
-	}
-}
-
 
 //
 // Window
@@ -154,9 +112,10 @@ Window::startAndFinish( Qt::ApplicationState state )
 			{
 				const int s = size().width() / 2;
 
-				d->imageList = new ImageList( QSize( s, s ), this );
-				QtMWidgets::ListModel< QImage > * imageModel =
-					new QtMWidgets::ListModel< QImage > ( this );
+				d->imageList = new QtMWidgets::ImageListView( this );
+				d->imageList->setMaxImageSize( QSize( s, s ) );
+				QtMWidgets::ListModel< QString > * imageModel =
+					new QtMWidgets::ListModel< QString > ( this );
 				d->imageList->setModel( imageModel );
 				d->stack->addWidget( d->imageList );
 
@@ -192,25 +151,21 @@ Window::startAndFinish( Qt::ApplicationState state )
 }
 
 void
-Window::_q_imageLoaded()
+Window::_q_filesFound()
 {
-	QImage image = d->future.result();
-
-	d->imageList->model()->insertRow( d->imageList->model()->rowCount() );
-	d->imageList->model()->setData( d->imageList->model()->rowCount() - 1, image );
+	const QStringList files = d->fileFuture.result();
 
-	d->loadImages();
-}
+	if( !files.isEmpty() )
+	{
+		QtMWidgets::ListModel< QString > * model = d->imageList->model();
 
-void
-Window::_q_filesFound()
-{
-	const bool start = d->imageFiles.isEmpty();
+		const int first = model->rowCount();
 
-	d->imageFiles += d->fileFuture.result();
+		model->insertRows( first, files.count() );
 
-	if( start )
-		d->loadImages();
+		for( int i = 0; i < files.count(); ++i )
+			model->setData( first + i, files.at( i ) );
+	}
 
 	if( !d->imageLocations.isEmpty() )
 	{
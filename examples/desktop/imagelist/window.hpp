@@ -33,8 +33,6 @@ public slots:
 	void startAndFinish( Qt::ApplicationState state );
 
 private slots:
-	//! Image loaded.
-	void _q_imageLoaded();
 	//! Files found.
 	void _q_filesFound();
 
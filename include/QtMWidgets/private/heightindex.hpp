@@ -0,0 +1 @@
+#include "../../../src/private/heightindex.hpp"
@@ -0,0 +1 @@
+#include "../../../src/private/imagelistview_p.hpp"
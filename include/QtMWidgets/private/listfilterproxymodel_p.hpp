@@ -0,0 +1 @@
+#include "../../../src/private/listfilterproxymodel_p.hpp"
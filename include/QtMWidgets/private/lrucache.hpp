@@ -0,0 +1 @@
+#include "../../../src/private/lrucache.hpp"
@@ -0,0 +1 @@
+#include "../../../src/private/pickersections.hpp"
@@ -11,6 +11,9 @@
 #include <QObject>
 #include <QScopedPointer>
 
+// QtMWidgets include.
+#include "memoryusage.hpp"
+
 
 namespace QtMWidgets {
 
@@ -24,9 +27,25 @@ class AbstractListModel
 {
 	Q_OBJECT
 
+public:
+	//! Hint of what the change of the data affects.
+	enum ChangeHint {
+		//! Change may affect height of the rows, rows will be measured again.
+		LayoutChange = 0,
+		//! Change affects only look of the rows, rows will be repainted only.
+		PaintOnlyChange = 1
+	}; // enum ChangeHint
+
+	Q_ENUM( ChangeHint )
+
 signals:
-	//! Emits when data changed in the range from \a first to the \a last.
-	void dataChanged( int first, int last );
+	/*!
+		Emits when data changed in the range from \a first to the \a last.
+		\a hint tells if height of the rows may change.
+	*/
+	void dataChanged( int first, int last,
+		QtMWidgets::AbstractListModel::ChangeHint hint =
+			QtMWidgets::AbstractListModel::LayoutChange );
 	//! Emits when model resets.
 	void modelReset();
 	//! Emits when new rows inserted.
@@ -41,6 +60,15 @@ public:
 	{
 	}
 
+	//! \return Approximate memory owned by the model.
+	virtual MemoryUsage memoryUsage() const
+	{
+		MemoryUsage u;
+		u.add( MemoryUsage::Data, sizeof( AbstractListModel ) );
+
+		return u;
+	}
+
 protected:
 	AbstractListModel( QObject * parent = 0 )
 		:	QObject( parent )
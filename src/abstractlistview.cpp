@@ -7,9 +7,37 @@
 // QtMWidgets include.
 #include "abstractlistview.hpp"
 
+// Qt include.
+#include <QtMath>
+#include <QVariantAnimation>
+
+// C++ include.
+#include <algorithm>
+#include <functional>
+
+#ifndef QT_NO_ACCESSIBILITY
+#include <QAccessible>
+#endif
+
 
 namespace QtMWidgets {
 
+//! Byte budget of the row cache of one view.
+static const qint64 c_rowCacheBytes = 4 * 1024 * 1024;
+//! Count of the rows pre-rendered on each side of the viewport at rest.
+static const int c_prerenderRows = 2;
+//! Maximum count of the rows pre-rendered on one side of the viewport.
+static const int c_maxPrerenderRows = 16;
+//! How far ahead in milliseconds rows are pre-rendered while scrolling.
+static const int c_prerenderLookahead = 250;
+//! Scroll velocity is forgotten after this count of milliseconds.
+static const int c_scrollVelocityTimeout = 100;
+//! Duration of the scroll animation in milliseconds.
+static const int c_scrollAnimationDuration = 300;
+//! Longest animated distance in viewport heights, longer is condensed.
+static const int c_maxAnimatedScreens = 2;
+
+
 //
 // AbstractListViewBasePrivate
 //
@@ -17,7 +45,13 @@ namespace QtMWidgets {
 AbstractListViewBasePrivate::AbstractListViewBasePrivate(
 	AbstractListViewBase * parent )
 	:	AbstractScrollAreaPrivate( parent )
+	,	orientation( Qt::Vertical )
 	,	spacing( 0 )
+	,	heightEstimation( false )
+	,	rowCacheWidth( -1 )
+	,	rowCacheRatio( 0.0 )
+	,	scrollVelocity( 0.0 )
+	,	scrollAnimation( 0 )
 {
 }
 
@@ -37,6 +71,283 @@ AbstractListViewBasePrivate::q_func() const
 	return static_cast< const AbstractListViewBase* >( q );
 }
 
+void
+AbstractListViewBasePrivate::animateScroll( int to )
+{
+	AbstractListViewBase * q = q_func();
+
+	stopScrollAnimation();
+
+	int from = scrollPosition();
+
+	if( from == to )
+		return;
+
+	// Rows between are not rendered, view jumps close to the target.
+	const int maxDistance = layoutRect().height() * c_maxAnimatedScreens;
+
+	if( qAbs( to - from ) > maxDistance )
+	{
+		from = ( to > from ? to - maxDistance : to + maxDistance );
+
+		q->jumpToPosition( scrollPoint( from ) );
+	}
+
+	if( !scrollAnimation )
+	{
+		scrollAnimation = new QVariantAnimation( q );
+		scrollAnimation->setDuration( c_scrollAnimationDuration );
+		scrollAnimation->setEasingCurve( QEasingCurve::OutCubic );
+
+		QObject::connect( scrollAnimation, &QVariantAnimation::valueChanged,
+			q, [this] ( const QVariant & value )
+			{
+				q_func()->jumpToPosition( scrollPoint( value.toInt() ) );
+			} );
+
+		QObject::connect( scrollAnimation, &QVariantAnimation::finished,
+			q, [this] () { setInteracting( false ); } );
+	}
+
+	scrollAnimation->setStartValue( from );
+	scrollAnimation->setEndValue( to );
+
+	setInteracting( true );
+
+	scrollAnimation->start();
+}
+
+void
+AbstractListViewBasePrivate::stopScrollAnimation()
+{
+	if( scrollAnimation &&
+		scrollAnimation->state() != QAbstractAnimation::Stopped )
+	{
+		scrollAnimation->stop();
+
+		setInteracting( false );
+	}
+}
+
+QPoint
+AbstractListViewBasePrivate::oriented( const QPoint & p ) const
+{
+	return ( orientation == Qt::Horizontal ? QPoint( p.y(), p.x() ) : p );
+}
+
+QSize
+AbstractListViewBasePrivate::oriented( const QSize & s ) const
+{
+	return ( orientation == Qt::Horizontal ? s.transposed() : s );
+}
+
+QRect
+AbstractListViewBasePrivate::oriented( const QRect & r ) const
+{
+	return QRect( oriented( r.topLeft() ), oriented( r.size() ) );
+}
+
+QRect
+AbstractListViewBasePrivate::layoutRect() const
+{
+	return oriented( viewport->rect() );
+}
+
+int
+AbstractListViewBasePrivate::scrollPosition() const
+{
+	return oriented( topLeftCorner ).y();
+}
+
+QPoint
+AbstractListViewBasePrivate::scrollPoint( int position ) const
+{
+	return oriented( QPoint( oriented( topLeftCorner ).x(), position ) );
+}
+
+void
+AbstractListViewBasePrivate::dropDraftRows()
+{
+	if( rowCache )
+	{
+		foreach( int row, draftRows )
+			rowCache->remove( row );
+	}
+
+	draftRows.clear();
+}
+
+void
+AbstractListViewBasePrivate::invalidateRows( int firstRow, int lastRow )
+{
+	if( rowCache )
+	{
+		for( int row = firstRow; row <= lastRow; ++row )
+			rowCache->remove( row );
+	}
+
+	for( int row = firstRow; row <= lastRow; ++row )
+		draftRows.remove( row );
+}
+
+void
+AbstractListViewBasePrivate::shiftRows( int row, int delta )
+{
+	if( delta == 0 )
+		return;
+
+	if( rowCache )
+	{
+		QList< int > rows;
+
+		foreach( int r, rowCache->keys() )
+		{
+			if( r >= row )
+				rows.append( r );
+		}
+
+		// Move the farthest rows first to not overwrite rows not moved yet.
+		if( delta > 0 )
+			std::sort( rows.begin(), rows.end(), std::greater< int > () );
+		else
+			std::sort( rows.begin(), rows.end() );
+
+		foreach( int r, rows )
+			rowCache->rename( r, r + delta );
+	}
+
+	QSet< int > drafts;
+
+	foreach( int r, draftRows )
+		drafts.insert( r >= row ? r + delta : r );
+
+	draftRows = drafts;
+}
+
+void
+AbstractListViewBasePrivate::clearRowCache()
+{
+	if( rowCache )
+		rowCache->clear();
+
+	draftRows.clear();
+}
+
+void
+AbstractListViewBasePrivate::trackScroll( int dy )
+{
+	if( !scrollTimer.isValid() )
+	{
+		scrollTimer.start();
+		scrollVelocity = 0.0;
+
+		return;
+	}
+
+	const qint64 elapsed = scrollTimer.restart();
+
+	if( elapsed > c_scrollVelocityTimeout )
+		scrollVelocity = 0.0;
+	else
+		scrollVelocity = ( scrollVelocity +
+			static_cast< qreal > ( dy ) / qMax( elapsed, Q_INT64_C( 1 ) ) ) / 2.0;
+}
+
+void
+AbstractListViewBasePrivate::prerenderRange( int rowHeight,
+	int * above, int * below ) const
+{
+	*above = c_prerenderRows;
+	*below = c_prerenderRows;
+
+	if( rowHeight <= 0 || !scrollTimer.isValid() ||
+		scrollTimer.elapsed() > c_scrollVelocityTimeout )
+			return;
+
+	const int ahead = qMin( c_maxPrerenderRows, c_prerenderRows +
+		qCeil( qAbs( scrollVelocity ) * c_prerenderLookahead / rowHeight ) );
+	const int behind = c_prerenderRows / 2;
+
+	// Rows move up, so the rows below enter the viewport.
+	if( scrollVelocity < 0.0 )
+	{
+		*above = behind;
+		*below = ahead;
+	}
+	else if( scrollVelocity > 0.0 )
+	{
+		*above = ahead;
+		*below = behind;
+	}
+}
+
+
+#ifndef QT_NO_ACCESSIBILITY
+
+//
+// AbstractListViewAccessible
+//
+
+//! Accessible interface of the list view, rows are created lazily.
+class AbstractListViewAccessible
+	:	public ListAccessible
+{
+public:
+	explicit AbstractListViewAccessible( AbstractListViewBase * view )
+		:	ListAccessible( view )
+	{
+	}
+
+	int rowCount() const override
+	{
+		return d()->rowCount();
+	}
+
+	QVector< int > visibleRows() const override
+	{
+		return d()->visibleRows();
+	}
+
+	QRect rowRect( int row ) const override
+	{
+		const QRect r = d()->rowRect( row );
+
+		if( r.isNull() )
+			return r;
+
+		return QRect( d()->viewport->mapTo( widget(), r.topLeft() ), r.size() );
+	}
+
+	QString rowText( int row ) const override
+	{
+		return view()->accessibleRowText( row );
+	}
+
+private:
+	const AbstractListViewBase * view() const
+	{
+		return static_cast< const AbstractListViewBase* > ( widget() );
+	}
+
+	const AbstractListViewBasePrivate * d() const
+	{
+		return view()->d_func();
+	}
+}; // class AbstractListViewAccessible
+
+static QAccessibleInterface *
+abstractListViewAccessibleFactory( const QString & className, QObject * object )
+{
+	if( className == QLatin1String( "QtMWidgets::AbstractListViewBase" ) &&
+		object && object->isWidgetType() )
+			return new AbstractListViewAccessible(
+				static_cast< AbstractListViewBase* > ( object ) );
+
+	return 0;
+}
+
+#endif // QT_NO_ACCESSIBILITY
+
 
 //
 // AbstractListViewBase
@@ -46,6 +357,14 @@ AbstractListViewBase::AbstractListViewBase(
 	AbstractListViewBasePrivate * dd, QWidget * parent )
 	:	AbstractScrollArea( dd, parent )
 {
+#ifndef QT_NO_ACCESSIBILITY
+	static const bool factoryInstalled = ( QAccessible::installFactory(
+		abstractListViewAccessibleFactory ), true );
+	Q_UNUSED( factoryInstalled )
+#endif
+
+	connect( this, &AbstractScrollArea::interactingChanged, this,
+		[this] ( bool on ) { if( !on ) d_func()->dropDraftRows(); } );
 }
 
 AbstractListViewBase::~AbstractListViewBase()
@@ -76,4 +395,95 @@ AbstractListViewBase::setSpacing( int s )
 	}
 }
 
+Qt::Orientation
+AbstractListViewBase::orientation() const
+{
+	const AbstractListViewBasePrivate * d = d_func();
+
+	return d->orientation;
+}
+
+void
+AbstractListViewBase::setOrientation( Qt::Orientation o )
+{
+	AbstractListViewBasePrivate * d = d_func();
+
+	if( d->orientation != o )
+	{
+		d->orientation = o;
+
+		d->stopScrollAnimation();
+		d->clearRowCache();
+		d->rowCacheWidth = -1;
+
+		// Shown area is anchored to the first visible row again.
+		d->topLeftCorner = QPoint( 0, 0 );
+
+		recalculateSize();
+
+		update();
+	}
+}
+
+bool
+AbstractListViewBase::heightEstimation() const
+{
+	const AbstractListViewBasePrivate * d = d_func();
+
+	return d->heightEstimation;
+}
+
+void
+AbstractListViewBase::setHeightEstimation( bool on )
+{
+	AbstractListViewBasePrivate * d = d_func();
+
+	// Takes effect when rows are measured again.
+	d->heightEstimation = on;
+}
+
+bool
+AbstractListViewBase::rowCaching() const
+{
+	const AbstractListViewBasePrivate * d = d_func();
+
+	return !d->rowCache.isNull();
+}
+
+void
+AbstractListViewBase::setRowCaching( bool on )
+{
+	AbstractListViewBasePrivate * d = d_func();
+
+	if( on == rowCaching() )
+		return;
+
+	if( on )
+		d->rowCache.reset( new LruCache< int, QPixmap >(
+			QStringLiteral( "AbstractListView" ), c_rowCacheBytes ) );
+	else
+		d->rowCache.reset();
+
+	d->draftRows.clear();
+	d->rowCacheWidth = -1;
+
+	d->viewport->update();
+}
+
+QString
+AbstractListViewBase::accessibleRowText( int row ) const
+{
+	Q_UNUSED( row )
+
+	return QString();
+}
+
+void
+AbstractListViewBase::setRowLabelFunction( const RowLabelFunction & f )
+{
+	AbstractListViewBasePrivate * d = d_func();
+
+	d->rowLabelFunction = f;
+}
+
 } /* namespace QtMWidgets */
@@ -12,6 +12,10 @@
 #include "private/abstractscrollarea_p.hpp"
 #include "listmodel.hpp"
 #include "fingergeometry.hpp"
+#include "private/heightindex.hpp"
+#include "private/idlescheduler.hpp"
+#include "private/lrucache.hpp"
+#include "private/listaccessible.hpp"
 
 // Qt include.
 #include <QWidget>
@@ -19,6 +23,12 @@
 #include <QTimer>
 #include <QElapsedTimer>
 #include <QPainter>
+#include <QPixmap>
+#include <QSet>
+#include <QVariantAnimation>
+
+// C++ include.
+#include <algorithm>
 
 
 namespace QtMWidgets {
@@ -41,14 +51,153 @@ public:
 
 	inline const AbstractListViewBase * q_func() const;
 
+	//! Remove cached rows rendered while interacting.
+	void dropDraftRows();
+	//! Remove cached rows in the given range.
+	void invalidateRows( int firstRow, int lastRow );
+	//! Move cached rows starting from the \a row by \a delta rows.
+	void shiftRows( int row, int delta );
+	//! Remove all cached rows.
+	void clearRowCache();
+	//! Remember scroll by \a dy to estimate scroll velocity.
+	void trackScroll( int dy );
+	/*!
+		Calculate count of the rows to pre-render \a above and \a below
+		the viewport from the recent scroll direction and velocity.
+	*/
+	void prerenderRange( int rowHeight, int * above, int * below ) const;
+	/*!
+		Animate scrolling to the \a to position. Long distance is
+		condensed, the view jumps close to the target first.
+	*/
+	void animateScroll( int to );
+	//! Stop scroll animation if it's running.
+	void stopScrollAnimation();
+	/*!
+		\return \a p with swapped coordinates if orientation is horizontal.
+
+		Rows are always laid out along y axis in the layout coordinates,
+		so this maps viewport coordinates to the layout ones and back.
+	*/
+	QPoint oriented( const QPoint & p ) const;
+	//! \return \a s with swapped dimensions if orientation is horizontal.
+	QSize oriented( const QSize & s ) const;
+	//! \return \a r with swapped coordinates if orientation is horizontal.
+	QRect oriented( const QRect & r ) const;
+	//! \return Rectangle of the viewport in the layout coordinates.
+	QRect layoutRect() const;
+	//! \return Scroll position along the rows.
+	int scrollPosition() const;
+	//! \return Top-left corner of the area scrolled to the \a position.
+	QPoint scrollPoint( int position ) const;
+	//! \return Count of the rows in the model.
+	virtual int rowCount() const = 0;
+	//! \return Rows shown in the viewport.
+	virtual QVector< int > visibleRows() const = 0;
+	//! \return Rectangle of the \a row on the viewport, null if it's not visible.
+	virtual QRect rowRect( int row ) const = 0;
+
+	//! Orientation.
+	Qt::Orientation orientation;
 	//! Spacing.
 	int spacing;
+	//! Are heights of the far rows estimated.
+	bool heightEstimation;
+	//! Cache of the rendered rows, 0 if rows are not cached.
+	QScopedPointer< LruCache< int, QPixmap > > rowCache;
+	//! Cached rows rendered while interacting.
+	QSet< int > draftRows;
+	//! Width of the cached rows.
+	int rowCacheWidth;
+	//! Device pixel ratio of the cached rows.
+	qreal rowCacheRatio;
+	//! Scroll velocity in pixels per millisecond, negative if rows move up.
+	qreal scrollVelocity;
+	//! Time since the last scroll.
+	QElapsedTimer scrollTimer;
+	//! Function returning label of the row shown while scrubbing.
+	std::function< QString ( int ) > rowLabelFunction;
+	//! Animation of scrollTo(), 0 if it was not created yet.
+	QVariantAnimation * scrollAnimation;
 }; // AbstractListViewBasePrivate
 
 
 template< typename T >
 class AbstractListView;
 
+template< typename T >
+class AbstractListViewPrivate;
+
+
+namespace Private {
+
+//
+// RowHeightsJob
+//
+
+//! Measures rows with estimated heights in slices.
+template< typename T >
+class RowHeightsJob
+	:	public IdleJob
+{
+public:
+	explicit RowHeightsJob( AbstractListViewPrivate< T > * dd )
+		:	IdleJob( "AbstractListView::refineRowHeights",
+				IdleJob::LowPriority )
+		,	d( dd )
+		,	row( 0 )
+	{
+	}
+
+	//! Start measuring from the given \a r row.
+	void restart( int r )
+	{
+		row = r;
+	}
+
+protected:
+	bool run( const QDeadlineTimer & sliceEnd ) override
+	{
+		return d->refineHeights( sliceEnd, row );
+	}
+
+private:
+	AbstractListViewPrivate< T > * d;
+	int row;
+}; // class RowHeightsJob
+
+
+//
+// RowPrerenderJob
+//
+
+//! Renders rows around the viewport into the row cache.
+template< typename T >
+class RowPrerenderJob
+	:	public IdleJob
+{
+public:
+	explicit RowPrerenderJob( AbstractListViewPrivate< T > * dd )
+		:	IdleJob( "AbstractListView::prerenderRows" )
+		,	d( dd )
+	{
+	}
+
+	//! Rows to render, the first are rendered first.
+	QVector< int > rows;
+
+protected:
+	bool run( const QDeadlineTimer & sliceEnd ) override
+	{
+		return d->prerenderRows( sliceEnd, rows );
+	}
+
+private:
+	AbstractListViewPrivate< T > * d;
+}; // class RowPrerenderJob
+
+} /* namespace Private */
+
 
 //
 // AbstractListViewPrivate
@@ -64,10 +213,73 @@ public:
 
 	int maxOffsetAndFirstVisibleRow( int * row = 0 ) const;
 	int calculateScroll( int row, int expectedOffset ) const;
+	//! Scroll by \a delta using the heights index.
+	void scrollBy( int delta, bool animated );
 	bool canScrollDown( int row ) const;
 	void normalizeOffset( int & row, int & offset );
-	QSize calcScrolledAreaSize() const;
+	QSize calcScrolledAreaSize();
 	bool updateIfNeeded( int firstRow, int lastRow );
+	//! Repaint visible rows in the given range without layout.
+	void repaintRows( int firstRow, int lastRow );
+	int rowCount() const override;
+	QVector< int > visibleRows() const override;
+	QRect rowRect( int row ) const override;
+	//! \return Is heights index valid for the given count of rows.
+	bool isHeightsValid( int rowCount ) const;
+	//! Measure all rows.
+	void measureAllRows();
+	//! Measure rows in the given range, heights index should be valid.
+	void measureRows( int firstRow, int lastRow );
+	/*!
+		Measure rows with estimated heights starting from \a row
+		until \a sliceEnd expires.
+
+		\return Are all heights exact?
+	*/
+	bool refineHeights( const QDeadlineTimer & sliceEnd, int & row );
+	//! Keep the first visible row at the top after heights changed.
+	void anchorToFirstVisibleRow();
+	/*!
+		\return Height of the section header above the \a row with
+		spacing, 0 if the row doesn't start a section.
+	*/
+	int headerExtent( int row, int width ) const;
+	//! \return Height of the \a row with spacing and section header.
+	int rowExtent( int row, int width ) const;
+	//! Find first rows of all sections.
+	void rebuildSections();
+	//! Check again whether rows in the given range start sections.
+	void updateSections( int firstRow, int lastRow );
+	//! Shift sections starting at the \a row or later by \a delta rows.
+	void shiftSections( int row, int delta );
+	//! Forget sections starting in the given range of rows.
+	void removeSections( int firstRow, int lastRow );
+	//! \return First row of the section of the \a row, -1 if none.
+	int sectionOf( int row ) const;
+	//! \return Cached image of the header of the \a section.
+	const QPixmap & stickyHeader( int section, int width );
+	/*!
+		\return Bottom of the sticky header pushed up by the header of
+		the next section, 0 if there is no sticky header.
+	*/
+	int stickyHeaderBottom( int width ) const;
+	//! Drop cached image of the sticky header.
+	void invalidateStickyHeader();
+	/*!
+		\return Cached image of the \a row, the row is rendered if
+		it's not in the cache. 0 if the row can't be cached.
+	*/
+	const QPixmap * cachedRow( int row, int width, int height );
+	//! Render \a row into the cache.
+	const QPixmap * renderRow( int row, int width, int height );
+	//! Post pre-rendering of the rows around the visible ones.
+	void schedulePrerender( int firstRow, int lastRow );
+	/*!
+		Render \a rows into the cache until \a sliceEnd expires.
+
+		\return Are all rows rendered?
+	*/
+	bool prerenderRows( const QDeadlineTimer & sliceEnd, QVector< int > & rows );
 	void init();
 
 	inline AbstractListView< T > * q_func();
@@ -87,6 +299,26 @@ public:
 	QTimer * timer;
 	//! Elapsed timer.
 	QElapsedTimer elapsedTimer;
+	//! Heights of the rows with spacing.
+	HeightIndex heights;
+	//! Width of the rows the heights measured for, -1 if not measured.
+	int heightsWidth;
+	//! Spacing the heights measured with.
+	int heightsSpacing;
+	//! Average height of the measured rows without spacing.
+	int averageHeight;
+	//! Job measuring estimated rows.
+	Private::RowHeightsJob< T > heightsJob;
+	//! Job rendering rows around the viewport.
+	Private::RowPrerenderJob< T > prerenderJob;
+	//! First rows of the sections, sorted.
+	QVector< int > sections;
+	//! Cached image of the sticky header.
+	QPixmap stickyPixmap;
+	//! Section of the cached sticky header, -1 if not cached.
+	int stickySection;
+	//! Width of the cached sticky header.
+	int stickyWidth;
 }; // class AbstractListViewPrivate
 
 
@@ -125,24 +357,78 @@ private:
 	{
 		int row = data->firstVisibleRow;
 		const int spacing = data->spacing;
-		const QRect r = rect();
+		const QRect r = data->layoutRect();
 		const int x = spacing;
 		int y = data->offset + spacing;
 
+		p->setRenderHint( QPainter::SmoothPixmapTransform,
+			!data->q_func()->isInteracting() );
+
 		if( data->model && row >= 0 )
+		{
+			const int width = r.width() - spacing * 2;
+			// Top of the first header below the first visible row.
+			int nextHeaderY = INT_MAX;
+
 			while( y < r.y() + r.height() && row < data->model->rowCount() )
 			{
-				const int width = r.width() - spacing * 2;
+				const int header = data->headerExtent( row, width );
+
+				if( header > 0 )
+				{
+					if( row > data->firstVisibleRow && nextHeaderY == INT_MAX )
+						nextHeaderY = y;
+
+					data->q_func()->drawSectionHeader( p, data->oriented(
+						QRect( x, y, width, header - spacing ) ), row );
+
+					y += header;
+				}
+
 				const int height =
 					data->q_func()->rowHeightForWidth( row, width );
 
-				const QRect rowRect( x, y, width, height );
+				const QRect rowRect =
+					data->oriented( QRect( x, y, width, height ) );
 
-				data->q_func()->drawRow( p, rowRect, row );
+				const QPixmap * pixmap = ( data->rowCache ?
+					data->cachedRow( row, width, height ) : 0 );
+
+				if( pixmap )
+					p->drawPixmap( rowRect.topLeft(), *pixmap );
+				else
+					data->q_func()->drawRow( p, rowRect, row );
 
 				y += height + spacing;
 				++row;
 			}
+
+			if( data->rowCache && row > data->firstVisibleRow )
+				data->schedulePrerender( data->firstVisibleRow, row - 1 );
+
+			drawStickyHeader( p, x, width, nextHeaderY );
+		}
+	}
+
+	//! Draw header of the current section at the start of the viewport.
+	void drawStickyHeader( QPainter * p, int x, int width, int nextHeaderY )
+	{
+		const int section = data->sectionOf( data->firstVisibleRow );
+
+		if( section < 0 )
+			return;
+
+		const QPixmap & pixmap = data->stickyHeader( section, width );
+
+		if( pixmap.isNull() )
+			return;
+
+		const int height = qRound( data->oriented( pixmap.size() ).height() /
+			pixmap.devicePixelRatio() );
+
+		// Header of the next section pushes the sticky one up.
+		p->drawPixmap( data->oriented( QPoint( x, qMin( data->spacing,
+			nextHeaderY - height - data->spacing ) ) ), pixmap );
 	}
 
 private:
@@ -175,6 +461,53 @@ class AbstractListViewBase
 		By default, this property contains a value of 0.
 	*/
 	Q_PROPERTY( int spacing READ spacing WRITE setSpacing )
+	/*!
+		\property orientation
+
+		This property holds the direction the rows are laid out in.
+
+		With Qt::Horizontal rows are laid out from left to right in a
+		strip, e.g. cover flow or timeline. Layout is the same as the
+		vertical one with swapped axes: rowHeightForWidth() returns
+		width of the row for the given height of the strip, section
+		headers are drawn at the left of their rows and the sticky
+		header sticks to the left edge. Scrubber is shown in vertical
+		orientation only.
+
+		By default, this property is Qt::Vertical.
+	*/
+	Q_PROPERTY( Qt::Orientation orientation READ orientation
+		WRITE setOrientation )
+	/*!
+		\property heightEstimation
+
+		This property holds whether heights of the rows far from
+		the viewport are estimated when all rows should be measured
+		again, for example when width of the view changed.
+
+		Rows near the viewport are measured at once, the rest get
+		estimatedRowHeight() and are measured later in idle time.
+		The first visible row stays at its place while estimated
+		heights are corrected.
+
+		By default, this property is false.
+	*/
+	Q_PROPERTY( bool heightEstimation READ heightEstimation
+		WRITE setHeightEstimation )
+	/*!
+		\property rowCaching
+
+		This property holds whether rendered rows are cached.
+
+		Cached rows are drawn from the cache until they are changed
+		in the model. In idle time rows just outside of the viewport
+		are rendered into the cache, more rows are rendered in the
+		direction of the scrolling, so the first frames of the fling
+		are drawn from the cache.
+
+		By default, this property is false.
+	*/
+	Q_PROPERTY( bool rowCaching READ rowCaching WRITE setRowCaching )
 
 signals:
 	//! This signal emits when user touched the row.
@@ -199,6 +532,9 @@ public:
 
 	Q_ENUM( ScrollHint )
 
+	//! Function that returns label of the \a row shown while scrubbing.
+	typedef std::function< QString ( int row ) > RowLabelFunction;
+
 public:
 	virtual ~AbstractListViewBase();
 
@@ -207,14 +543,46 @@ public:
 	//! Set spacing.
 	void setSpacing( int s );
 
+	//! \return Orientation.
+	Qt::Orientation orientation() const;
+	//! Set orientation.
+	void setOrientation( Qt::Orientation o );
+
+	//! \return Are heights of the far rows estimated.
+	bool heightEstimation() const;
+	//! Set whether heights of the far rows should be estimated.
+	void setHeightEstimation( bool on );
+
+	//! \return Are rendered rows cached.
+	bool rowCaching() const;
+	//! Set whether rendered rows should be cached.
+	void setRowCaching( bool on );
+
+	/*!
+		Set function that returns label of the row shown while
+		scrubbing, e.g. first letter of the section the row belongs to.
+	*/
+	void setRowLabelFunction( const RowLabelFunction & f );
+
 protected:
 	AbstractListViewBase( AbstractListViewBasePrivate * dd,
 		QWidget * parent = 0 );
 
 	virtual void recalculateSize() = 0;
 
+	/*!
+		\return Text of the \a row for assistive technology. Text is
+		requested only for the rows the assistive technology asked
+		for, usually visible ones, and is cached until the model changed.
+
+		Default implementation returns empty string.
+	*/
+	virtual QString accessibleRowText( int row ) const;
+
 protected slots:
-	virtual void dataChanged( int first, int last ) = 0;
+	virtual void dataChanged( int first, int last,
+		QtMWidgets::AbstractListModel::ChangeHint hint =
+			QtMWidgets::AbstractListModel::LayoutChange ) = 0;
 	virtual void modelReset() = 0;
 	virtual void rowsInserted( int first, int last ) = 0;
 	virtual void rowsRemoved( int first, int last ) = 0;
@@ -224,6 +592,7 @@ protected slots:
 
 private:
 	friend class AbstractListViewBasePrivate;
+	friend class AbstractListViewAccessible;
 
 	inline AbstractListViewBasePrivate * d_func()
 		{ return reinterpret_cast< AbstractListViewBasePrivate* >
@@ -266,6 +635,31 @@ public:
 		return d->model;
 	}
 
+	/*!
+		\return Approximate memory owned by the view, including
+		data of the model.
+	*/
+	MemoryUsage memoryUsage() const override
+	{
+		const AbstractListViewPrivate< T > * d = d_func();
+
+		MemoryUsage u = AbstractListViewBase::memoryUsage();
+
+		if( d->model )
+			u += d->model->memoryUsage();
+
+		if( d->timer )
+			u.add( MemoryUsage::Animations, sizeof( QTimer ) );
+
+		if( d->rowCache )
+			u.add( MemoryUsage::Caches, d->rowCache->usedBytes() );
+
+		if( d->scrollAnimation )
+			u.add( MemoryUsage::Animations, sizeof( QVariantAnimation ) );
+
+		return u;
+	}
+
 	//! Set model.
 	void setModel( ListModel< T > * m )
 	{
@@ -276,6 +670,11 @@ public:
 
 		d->model = m;
 
+		d->clearRowCache();
+		d->invalidateStickyHeader();
+
+		AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
 		connect( d->model, &ListModel< T >::dataChanged,
 			this, &AbstractListView< T >::dataChanged );
 		connect( d->model, &ListModel< T >::modelReset,
@@ -291,19 +690,24 @@ public:
 	/*!
 		\return The model row of the item at the viewport coordinates point.
 	*/
-	int rowAt( const QPoint & p ) const
+	int rowAt( const QPoint & point ) const
 	{
 		const AbstractListViewPrivate< T > * d = d_func();
 
+		const QPoint p = d->oriented( point );
 		int row = d->firstVisibleRow;
 		const int spacing = d->spacing;
 		const int x = spacing;
 		int y = d->offset;
-		const int width = d->viewport->width() - spacing * 2;
+		const int width = d->layoutRect().width() - spacing * 2;
 
 		if( p.x() < x || p.x() > x + width )
 			return -1;
 
+		// Sticky header covers rows under it.
+		if( p.y() < d->stickyHeaderBottom( width ) )
+			return -1;
+
 		bool lastIteration = false;
 
 		if( d->model )
@@ -311,7 +715,8 @@ public:
 			{
 				int height = rowHeightForWidth( row, width );
 
-				const QRect r( x, y, width, height );
+				const QRect r( x, y + d->headerExtent( row, width ),
+					width, height );
 
 				if( r.contains( p ) )
 					return row;
@@ -320,25 +725,21 @@ public:
 				{
 					if( p.y() < y )
 					{
-						int prevRowHeight = -1;
-
 						--row;
 
 						if( row < 0 )
 							return -1;
 
-						prevRowHeight = rowHeightForWidth( row, width );
-
-						y -= ( prevRowHeight + spacing );
+						y -= d->rowExtent( row, width );
 
 						if( y < p.y() )
 							lastIteration = true;
 					}
 					else if( p.y() > y )
 					{
-						++row;
+						y += d->rowExtent( row, width );
 
-						y += height + spacing;
+						++row;
 
 						if( y > p.y() )
 							lastIteration = true;
@@ -358,77 +759,42 @@ public:
 	*/
 	void scrollTo( int row, ScrollHint hint = EnsureVisible )
 	{
-		AbstractListViewPrivate< T > * d = d_func();
-
-		if( d->model && row >= 0 && row < d->model->rowCount() )
-		{
-			switch( hint )
-			{
-				case EnsureVisible :
-				{
-					if( !visualRect( row ).isNull() )
-						return;
-					else
-					{
-						const int offset = -1;
-
-						const int delta = d->calculateScroll( row, offset );
-
-						QPoint p = topLeftPointShownArea();
-						p.setY( p.y() + delta );
-						setTopLeftPointShownArea( p );
-					}
-				}
-					break;
-
-				case PositionAtTop :
-				{
-					const int offset = -1;
-
-					const int delta = d->calculateScroll( row, offset );
-
-					QPoint p = topLeftPointShownArea();
-					p.setY( p.y() + delta );
-					setTopLeftPointShownArea( p );
-				}
-					break;
-
-				case PositionAtBottom :
-				{
-					const QRect r = d->viewport->rect();
-
-					const int offset = r.y() + r.height() -
-						rowHeightForWidth( row,
-							r.width() - d->spacing * 2 ) - d->spacing - 1;
-
-					const int delta = d->calculateScroll( row, offset );
+		scrollToRow( row, hint, false );
+	}
 
-					QPoint p = topLeftPointShownArea();
-					p.setY( p.y() + delta );
-					setTopLeftPointShownArea( p );
-				}
-					break;
+	/*!
+		Same as scrollTo() but the view scrolls with animation.
 
-				case PositionAtCenter :
-				{
-					const QRect r = d->viewport->rect();
+		Target position is found in the heights index, so rows between
+		the current and the target positions are never measured. If the
+		target is far away the view jumps close to it and animates only
+		the last part of the distance, rows passed over are not rendered.
+	*/
+	void animateScrollTo( int row, ScrollHint hint = EnsureVisible )
+	{
+		scrollToRow( row, hint, true );
+	}
 
-					const int offset = r.y() + r.height() / 2 -
-						rowHeightForWidth( row,
-							r.width() - d->spacing * 2 ) / 2;
+	/*!
+		\return First row of the section the \a row belongs to,
+		-1 if the row is not in a section. Lookup is O(log n).
+	*/
+	int sectionAt( int row ) const
+	{
+		const AbstractListViewPrivate< T > * d = d_func();
 
-					const int delta = d->calculateScroll( row, offset );
+		return d->sectionOf( row );
+	}
 
-					QPoint p = topLeftPointShownArea();
-					p.setY( p.y() + delta );
-					setTopLeftPointShownArea( p );
-				}
-					break;
+	/*!
+		\return First row of the section shown at the top of the
+		viewport, -1 if there is no such section.
+	*/
+	int currentSection() const
+	{
+		const AbstractListViewPrivate< T > * d = d_func();
 
-				default :
-					break;
-			}
-		}
+		return d->sectionOf( d->firstVisibleRow );
 	}
 
 	/*!
@@ -446,25 +812,26 @@ public:
 		if( row >= d->firstVisibleRow )
 		{
 			int tmpRow = d->firstVisibleRow;
-			const QRect r = d->viewport->rect();
+			const QRect r = d->layoutRect();
 			const int spacing = d->spacing;
 			const int x = r.x() + spacing;
 			int y = r.y() + d->offset;
 			const int width = r.width() - spacing * 2;
-			int height = rowHeightForWidth( tmpRow, width );
 
 			while( tmpRow < row )
 			{
-				y += height + spacing;
+				y += d->rowExtent( tmpRow, width );
 
 				if( y > r.height() )
 					return QRect();
 
 				++tmpRow;
-				height = rowHeightForWidth( tmpRow, width );
 			}
 
-			return r.intersected( QRect( x, y, width, height ) );
+			y += d->headerExtent( row, width );
+
+			return d->oriented( r.intersected( QRect( x, y, width,
+				rowHeightForWidth( row, width ) ) ) );
 		}
 		else
 			return QRect();
@@ -480,11 +847,25 @@ protected:
 		d->init();
 	}
 
-	//! Draw row in the list view.
+	/*!
+		Draw row in the list view.
+
+		While isInteracting() returns true the content is moving and
+		implementation may draw cheaper version of the row. Rows visible
+		when interaction finished will be repainted in full quality.
+
+		If rowCaching is true the row may be drawn into the cache
+		image, \a rect starts at (0, 0) then.
+	*/
 	virtual void drawRow( QPainter * painter,
 		const QRect & rect, int row ) = 0;
 
-	//! \return Height of the given \a row row for the given \a width width.
+	/*!
+		\return Height of the given \a row row for the given \a width width.
+
+		In horizontal orientation \a width is height of the strip and
+		width of the row should be returned.
+	*/
 	virtual int rowHeightForWidth( int row, int width ) const
 	{
 		Q_UNUSED( row )
@@ -493,73 +874,255 @@ protected:
 		return FingerGeometry::height();
 	}
 
-	void scrollContentsBy( int dx, int dy ) override
+	/*!
+		\return Estimated height of the given \a row row for the given
+		\a width width. Used only if heightEstimation is true, should be
+		much cheaper than rowHeightForWidth().
+
+		Default implementation returns average height of the rows
+		measured near the viewport.
+	*/
+	virtual int estimatedRowHeight( int row, int width ) const
 	{
-		Q_UNUSED( dx )
+		Q_UNUSED( row )
+		Q_UNUSED( width )
 
-		AbstractListViewPrivate< T > * d = d_func();
+		const AbstractListViewPrivate< T > * d = d_func();
 
-		d->offset += dy;
+		return d->averageHeight;
+	}
 
-		d->normalizeOffset( d->firstVisibleRow, d->offset );
+	/*!
+		\return Does the \a row row start a new section. Header of
+		the section is drawn above the row and sticks to the top of
+		the viewport while rows of the section are shown.
+
+		Default implementation returns false, so there are no sections.
+	*/
+	virtual bool isSectionStart( int row ) const
+	{
+		Q_UNUSED( row )
+
+		return false;
 	}
 
-	void dataChanged( int first, int last ) override
+	/*!
+		\return Height of the header of the section started by the
+		\a row row for the given \a width width, width of the header
+		in horizontal orientation.
+	*/
+	virtual int sectionHeaderHeightForWidth( int row, int width ) const
 	{
-		AbstractListViewPrivate< T > * d = d_func();
+		Q_UNUSED( row )
+		Q_UNUSED( width )
 
-		recalculateSize();
+		return FingerGeometry::height() / 2;
+	}
 
-		d->updateIfNeeded( first, last );
+	/*!
+		Draw header of the section started by the \a row row.
+
+		Sticky header is drawn into the cached image, \a rect starts
+		at (0, 0) then.
+	*/
+	virtual void drawSectionHeader( QPainter * painter,
+		const QRect & rect, int row )
+	{
+		Q_UNUSED( row )
+
+		painter->fillRect( rect, palette().color( QPalette::Window ) );
 	}
 
-	void modelReset() override
+	/*!
+		Find the row at \a topLeft in the heights index in O(log n)
+		and show it without walking through the intermediate rows.
+	*/
+	void jumpToPosition( const QPoint & topLeft ) override
 	{
 		AbstractListViewPrivate< T > * d = d_func();
 
-		d->firstVisibleRow = -1;
-		d->offset = 0;
+		if( !d->model || d->model->rowCount() == 0 )
+			return;
 
-		recalculateSize();
+		if( !d->isHeightsValid( d->model->rowCount() ) )
+			setScrolledAreaSize( d->calcScrolledAreaSize() );
+
+		const int y = qBound( 0, d->oriented( topLeft ).y(),
+			qMax( 0, d->oriented( scrolledAreaSize() ).height() -
+				d->layoutRect().height() ) );
+		const int row = qMin( d->heights.rowAt( y ),
+			d->model->rowCount() - 1 );
+
+		d->firstVisibleRow = row;
+
+		// scrollContentsBy() adds the scrolled distance to the offset,
+		// so subclasses are notified as on any other scrolling.
+		d->offset = static_cast< int > ( d->heights.offset( row ) ) -
+			d->scrollPosition();
+
+		setTopLeftPointShownArea( d->scrollPoint( y ) );
+
+		d->calcIndicators();
+
+		if( d->scrubber )
+			d->scrubber->update();
 
 		d->viewport->update();
 	}
 
-	void rowsInserted( int first, int last ) override
+	/*!
+		\return Label of the row at \a topLeft if row label function
+		is set, label of the scroll area otherwise.
+	*/
+	QString scrubberLabel( const QPoint & topLeft ) const override
+	{
+		const AbstractListViewPrivate< T > * d = d_func();
+
+		if( d->rowLabelFunction && d->model &&
+			d->isHeightsValid( d->model->rowCount() ) &&
+			d->heights.count() > 0 )
+				return d->rowLabelFunction( qMin( d->heights.rowAt(
+					d->oriented( topLeft ).y() ), d->heights.count() - 1 ) );
+
+		return AbstractListViewBase::scrubberLabel( topLeft );
+	}
+
+	void scrollContentsBy( int dx, int dy ) override
 	{
 		AbstractListViewPrivate< T > * d = d_func();
 
-		if( d->firstVisibleRow == -1 )
-			d->firstVisibleRow = 0;
+		const int delta = ( d->orientation == Qt::Horizontal ? dx : dy );
 
-		recalculateSize();
+		d->offset += delta;
 
-		d->updateIfNeeded( first, last );
+		d->normalizeOffset( d->firstVisibleRow, d->offset );
+
+		d->trackScroll( delta );
+
+		AccessibleUpdates::post( this, AccessibleUpdates::Scrolled );
 	}
 
-	void rowsRemoved( int first, int last ) override
+	void dataChanged( int first, int last,
+		QtMWidgets::AbstractListModel::ChangeHint hint =
+			QtMWidgets::AbstractListModel::LayoutChange ) override
 	{
 		AbstractListViewPrivate< T > * d = d_func();
 
-		if( d->firstVisibleRow >= first && d->firstVisibleRow <= last )
-		{
-			if( d->model && d->model->rowCount() )
-			{
-				if( first - 1 >= 0 )
-					d->firstVisibleRow = first - 1;
-				else
-					d->firstVisibleRow = last + 1;
+		d->invalidateRows( first, last );
 
-				d->offset = 0;
-			}
-			else
+		AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
+		if( hint == AbstractListModel::PaintOnlyChange )
+		{
+			d->invalidateStickyHeader();
+			d->repaintRows( first, last );
+		}
+		else
+		{
+			// Changed row may start or end section of the next one.
+			const int lastRow = qMin( last + 1, d->model->rowCount() - 1 );
+
+			d->updateSections( first, lastRow );
+
+			if( d->isHeightsValid( d->model->rowCount() ) )
+				d->measureRows( first, lastRow );
+
+			setScrolledAreaSize( d->calcScrolledAreaSize() );
+
+			d->updateIfNeeded( first, last );
+		}
+	}
+
+	void modelReset() override
+	{
+		AbstractListViewPrivate< T > * d = d_func();
+
+		d->firstVisibleRow = -1;
+		d->offset = 0;
+
+		d->clearRowCache();
+
+		AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
+		recalculateSize();
+
+		d->viewport->update();
+	}
+
+	void rowsInserted( int first, int last ) override
+	{
+		AbstractListViewPrivate< T > * d = d_func();
+
+		if( d->firstVisibleRow == -1 )
+			d->firstVisibleRow = 0;
+
+		const int count = last - first + 1;
+
+		d->shiftRows( first, count );
+		// Next row may start or end section now.
+		d->invalidateRows( last + 1, last + 1 );
+
+		AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
+		if( d->isHeightsValid( d->model->rowCount() - count ) )
+		{
+			const int lastRow = qMin( last + 1, d->model->rowCount() - 1 );
+
+			d->heights.insert( first, count );
+			d->shiftSections( first, count );
+			d->updateSections( first, lastRow );
+			d->measureRows( first, lastRow );
+		}
+
+		setScrolledAreaSize( d->calcScrolledAreaSize() );
+
+		d->updateIfNeeded( first, last );
+	}
+
+	void rowsRemoved( int first, int last ) override
+	{
+		AbstractListViewPrivate< T > * d = d_func();
+
+		if( d->firstVisibleRow >= first && d->firstVisibleRow <= last )
+		{
+			if( d->model && d->model->rowCount() )
+			{
+				if( first - 1 >= 0 )
+					d->firstVisibleRow = first - 1;
+				else
+					d->firstVisibleRow = last + 1;
+
+				d->offset = 0;
+			}
+			else
 			{
 				d->firstVisibleRow = -1;
 				d->offset = 0;
 			}
 		}
 
-		recalculateSize();
+		const int count = last - first + 1;
+
+		// Row next to the removed ones may start or end section now.
+		d->invalidateRows( first, last + 1 );
+		d->shiftRows( last + 2, -count );
+
+		AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
+		if( d->isHeightsValid( d->model->rowCount() + count ) )
+		{
+			d->heights.remove( first, count );
+			d->removeSections( first, last );
+			d->shiftSections( last + 1, -count );
+
+			if( first < d->model->rowCount() )
+			{
+				d->updateSections( first, first );
+				d->measureRows( first, first );
+			}
+		}
+
+		setScrolledAreaSize( d->calcScrolledAreaSize() );
 
 		d->updateIfNeeded( first, last )	;
 	}
@@ -576,6 +1139,25 @@ protected:
 						+ sourceEnd - sourceStart ) )
 			d->offset = 0;
 
+		// Rows out of the range keep their positions.
+		d->invalidateRows( qMin( sourceStart, destinationRow ),
+			qMax( sourceEnd, destinationRow + sourceEnd - sourceStart ) + 1 );
+
+		AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
+		const int rowCount = d->model->rowCount();
+
+		if( d->isHeightsValid( rowCount ) && rowCount > 0 )
+		{
+			const int firstRow = qMin( sourceStart, destinationRow );
+			const int lastRow = qMin( rowCount - 1, qMax( sourceEnd,
+				destinationRow + sourceEnd - sourceStart ) + 1 );
+
+			// Rows out of the range keep their positions.
+			d->updateSections( firstRow, lastRow );
+			d->measureRows( firstRow, lastRow );
+		}
+
 		if( !d->updateIfNeeded( sourceStart, sourceEnd ) )
 			d->updateIfNeeded( destinationRow,
 				destinationRow + sourceEnd - sourceStart );
@@ -593,20 +1175,25 @@ protected:
 			emit rowLongTouched( row );
 	}
 
+	//! Measure all rows again and update size of the scrolled area.
 	void recalculateSize() override
 	{
 		AbstractListViewPrivate< T > * d = d_func();
 
+		d->heightsWidth = -1;
+
 		setScrolledAreaSize( d->calcScrolledAreaSize() );
 	}
 
 protected:
 	void mousePressEvent( QMouseEvent * e ) override
 	{
-		AbstractListViewBase::mousePressEvent( e );
-
 		AbstractListViewPrivate< T > * d = d_func();
 
+		d->stopScrollAnimation();
+
+		AbstractListViewBase::mousePressEvent( e );
+
 		if( e->button() == Qt::LeftButton )
 		{
 			if( d->elapsedTimer.elapsed() > 500 )
@@ -662,16 +1249,69 @@ protected:
 	{
 		AbstractListViewBase::resizeEvent( e );
 
-		recalculateSize();
-
 		AbstractListViewPrivate< T > * d = d_func();
 
+		// Rows are measured again only if their width changed.
+		setScrolledAreaSize( d->calcScrolledAreaSize() );
+
 		if( d->model &&
-			scrolledAreaSize().height() - topLeftPointShownArea().y() <=
-				d->viewport->height() )
+			d->oriented( scrolledAreaSize() ).height() - d->scrollPosition() <=
+				d->layoutRect().height() )
 				scrollTo( d->model->rowCount() - 1, PositionAtBottom );
 	}
 
+private:
+	//! Scroll to the \a row according to the \a hint.
+	void scrollToRow( int row, ScrollHint hint, bool animated )
+	{
+		AbstractListViewPrivate< T > * d = d_func();
+
+		if( !d->model || row < 0 || row >= d->model->rowCount() )
+			return;
+
+		// Heights index is needed to find the target without walking rows.
+		if( !d->isHeightsValid( d->model->rowCount() ) )
+			setScrolledAreaSize( d->calcScrolledAreaSize() );
+
+		const QRect r = d->layoutRect();
+
+		int offset = -1;
+
+		switch( hint )
+		{
+			case EnsureVisible :
+			{
+				if( !visualRect( row ).isNull() )
+					return;
+			}
+				break;
+
+			case PositionAtTop :
+				break;
+
+			case PositionAtBottom :
+			{
+				offset = r.y() + r.height() -
+					rowHeightForWidth( row,
+						r.width() - d->spacing * 2 ) - d->spacing - 1;
+			}
+				break;
+
+			case PositionAtCenter :
+			{
+				offset = r.y() + r.height() / 2 -
+					rowHeightForWidth( row,
+						r.width() - d->spacing * 2 ) / 2;
+			}
+				break;
+
+			default :
+				return;
+		}
+
+		d->scrollBy( d->calculateScroll( row, offset ), animated );
+	}
+
 private:
 	friend class AbstractListViewPrivate< T >;
 	friend class Private::Viewport< T >;
@@ -702,6 +1342,13 @@ AbstractListViewPrivate< T >::AbstractListViewPrivate(
 	,	mouseMoveDelta( 0 )
 	,	clickCount( 0 )
 	,	timer( 0 )
+	,	heightsWidth( -1 )
+	,	heightsSpacing( 0 )
+	,	averageHeight( FingerGeometry::height() )
+	,	heightsJob( this )
+	,	prerenderJob( this )
+	,	stickySection( -1 )
+	,	stickyWidth( -1 )
 {
 }
 
@@ -716,16 +1363,14 @@ inline
 int
 AbstractListViewPrivate< T >::maxOffsetAndFirstVisibleRow( int * row ) const
 {
-	const QRect r = viewport->rect();
+	const QRect r = layoutRect();
 	const int width = r.width() - spacing * 2;
 	int tmpRow = ( model ? model->rowCount() - 1 : -1 );
 	int y = 0;
 
-	const AbstractListView< T > * q = q_func();
-
 	while( y < r.height() && tmpRow >= 0 )
 	{
-		y += q->rowHeightForWidth( tmpRow, width ) + spacing;
+		y += rowExtent( tmpRow, width );
 		--tmpRow;
 	}
 
@@ -744,21 +1389,24 @@ int
 AbstractListViewPrivate< T >::calculateScroll( int row,
 	int expectedOffset ) const
 {
-	const int width = viewport->width() - spacing * 2;
+	// With the heights index distance is found in O(log n).
+	if( model && firstVisibleRow >= 0 && isHeightsValid( model->rowCount() ) )
+		return static_cast< int > ( heights.offset( row ) -
+			heights.offset( firstVisibleRow ) ) + offset - expectedOffset;
+
+	const int width = layoutRect().width() - spacing * 2;
 
 	int delta = - offset + expectedOffset;
 
 	int tmpRow = firstVisibleRow;
 
-	const AbstractListView< T > * q = q_func();
-
 	if( tmpRow > row )
 	{
 		--tmpRow;
 
 		while( tmpRow >= row )
 		{
-			delta += spacing + q->rowHeightForWidth( tmpRow, width );
+			delta += rowExtent( tmpRow, width );
 			--tmpRow;
 		}
 	}
@@ -766,7 +1414,7 @@ AbstractListViewPrivate< T >::calculateScroll( int row,
 	{
 		while( tmpRow < row )
 		{
-			delta -= ( q->rowHeightForWidth( tmpRow, width ) + spacing );
+			delta -= rowExtent( tmpRow, width );
 			++tmpRow;
 		}
 	}
@@ -774,6 +1422,27 @@ AbstractListViewPrivate< T >::calculateScroll( int row,
 	return -delta;
 }
 
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::scrollBy( int delta, bool animated )
+{
+	AbstractListView< T > * q = q_func();
+
+	const int to = qBound( 0, scrollPosition() + delta,
+		qMax( 0, oriented( scrolledAreaSize ).height() -
+			layoutRect().height() ) );
+
+	if( animated )
+		animateScroll( to );
+	else
+	{
+		stopScrollAnimation();
+
+		q->jumpToPosition( scrollPoint( to ) );
+	}
+}
+
 template< typename T >
 inline
 bool
@@ -800,13 +1469,11 @@ inline
 void
 AbstractListViewPrivate< T >::normalizeOffset( int & row, int & offset )
 {
-	AbstractListView< T > * q = q_func();
-
 	if( offset > 0 )
 	{
 		if( row > 0 )
 		{
-			const int width = viewport->rect().width() - spacing * 2;
+			const int width = layoutRect().width() - spacing * 2;
 
 			while( offset > 0 )
 			{
@@ -818,8 +1485,7 @@ AbstractListViewPrivate< T >::normalizeOffset( int & row, int & offset )
 					break;
 				}
 
-				const int delta = q->rowHeightForWidth( row,
-					width ) + spacing;
+				const int delta = rowExtent( row, width );
 				offset -= delta;
 			}
 		}
@@ -830,18 +1496,17 @@ AbstractListViewPrivate< T >::normalizeOffset( int & row, int & offset )
 	{
 		if( canScrollDown( row ) )
 		{
-			const int width = viewport->rect().width() - spacing * 2;
-			int height = q->rowHeightForWidth( row, width );
+			const int width = layoutRect().width() - spacing * 2;
+			int delta = rowExtent( row, width );
 
-			while( qAbs( offset ) > height + spacing )
+			while( qAbs( offset ) > delta )
 			{
-				const int delta = height + spacing;
 				offset += delta;
 
 				if( model && row < model->rowCount() - 1 )
 				{
 					++row;
-					height = q->rowHeightForWidth( row, width );
+					delta = rowExtent( row, width );
 				}
 				else
 				{
@@ -863,19 +1528,591 @@ AbstractListViewPrivate< T >::normalizeOffset( int & row, int & offset )
 template< typename T >
 inline
 QSize
-AbstractListViewPrivate< T >::calcScrolledAreaSize() const
+AbstractListViewPrivate< T >::calcScrolledAreaSize()
+{
+	if( !isHeightsValid( model ? model->rowCount() : 0 ) )
+		measureAllRows();
+
+	const qint64 height = spacing + heights.total();
+
+	return oriented( QSize( layoutRect().width(),
+		static_cast< int > ( qMin( height, (qint64) INT_MAX ) ) ) );
+}
+
+template< typename T >
+inline
+bool
+AbstractListViewPrivate< T >::isHeightsValid( int rowCount ) const
+{
+	return ( heightsWidth == layoutRect().width() - spacing * 2 &&
+		heightsSpacing == spacing && heights.count() == rowCount );
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::measureAllRows()
 {
 	const AbstractListView< T > * q = q_func();
 
-	const int width = viewport->rect().width();
-	const int rowWidth = width - spacing * 2;
-	int height = spacing;
+	heightsWidth = layoutRect().width() - spacing * 2;
+	heightsSpacing = spacing;
+
+	rebuildSections();
+
+	const int count = ( model ? model->rowCount() : 0 );
+
+	QVector< int > h( count, 0 );
+
+	// Without estimation all rows are exact.
+	int first = 0;
+	int last = count;
+
+	if( heightEstimation && count > 0 )
+	{
+		// Rows from one viewport above to two viewports below the
+		// first visible row are measured right now.
+		const int viewportHeight = layoutRect().height();
+		const int anchor = qBound( 0, firstVisibleRow, count - 1 );
+		qint64 sum = 0;
+		int y = 0;
+
+		for( last = anchor; last < count &&
+			( last == anchor || y < viewportHeight * 2 ); ++last )
+		{
+			const int header = headerExtent( last, heightsWidth );
+
+			h[ last ] = header +
+				q->rowHeightForWidth( last, heightsWidth ) + spacing;
+			y += h.at( last );
+			sum += h.at( last ) - header;
+		}
+
+		y = 0;
+
+		for( first = anchor; first > 0 && y < viewportHeight; )
+		{
+			--first;
+
+			const int header = headerExtent( first, heightsWidth );
+
+			h[ first ] = header +
+				q->rowHeightForWidth( first, heightsWidth ) + spacing;
+			y += h.at( first );
+			sum += h.at( first ) - header;
+		}
+
+		averageHeight = qMax( 1,
+			static_cast< int > ( sum / ( last - first ) ) - spacing );
+
+		for( int i = 0; i < first; ++i )
+			h[ i ] = headerExtent( i, heightsWidth ) +
+				q->estimatedRowHeight( i, heightsWidth ) + spacing;
+
+		for( int i = last; i < count; ++i )
+			h[ i ] = headerExtent( i, heightsWidth ) +
+				q->estimatedRowHeight( i, heightsWidth ) + spacing;
+	}
+	else
+	{
+		for( int i = 0; i < count; ++i )
+			h[ i ] = rowExtent( i, heightsWidth );
+	}
+
+	heights.assign( h );
+
+	IdleScheduler * scheduler = IdleScheduler::instance();
+
+	if( first > 0 || last < count )
+	{
+		for( int i = 0; i < first; ++i )
+			heights.setEstimatedHeight( i, h.at( i ) );
+
+		for( int i = last; i < count; ++i )
+			heights.setEstimatedHeight( i, h.at( i ) );
+
+		// Rows below the viewport are more likely to be shown next.
+		heightsJob.restart( last );
+
+		scheduler->post( &heightsJob );
+	}
+	else if( heightsJob.isPending() )
+		scheduler->cancel( &heightsJob );
+
+	anchorToFirstVisibleRow();
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::measureRows( int firstRow, int lastRow )
+{
+	for( int i = firstRow; i <= lastRow; ++i )
+		heights.setHeight( i, rowExtent( i, heightsWidth ) );
+}
+
+template< typename T >
+inline
+bool
+AbstractListViewPrivate< T >::refineHeights( const QDeadlineTimer & sliceEnd,
+	int & row )
+{
+	AbstractListView< T > * q = q_func();
+
+	// Heights are outdated and will be measured again from scratch.
+	if( !isHeightsValid( model ? model->rowCount() : 0 ) )
+		return true;
 
-	if( model )
-		for( int i = 0, last = model->rowCount(); i < last; ++i )
-			height += q->rowHeightForWidth( i, rowWidth ) + spacing;
+	while( true )
+	{
+		row = heights.nextEstimated( row );
+
+		if( row < 0 )
+			row = heights.nextEstimated( 0 );
+
+		if( row < 0 )
+			break;
+
+		heights.setHeight( row, rowExtent( row, heightsWidth ) );
+
+		++row;
+
+		if( sliceEnd.hasExpired() )
+			break;
+	}
+
+	anchorToFirstVisibleRow();
+
+	q->setScrolledAreaSize( calcScrolledAreaSize() );
+
+	return ( heights.estimatedCount() == 0 );
+}
+
+template< typename T >
+inline
+const QPixmap *
+AbstractListViewPrivate< T >::cachedRow( int row, int width, int height )
+{
+	const qreal ratio = viewport->devicePixelRatioF();
+
+	if( width != rowCacheWidth || ratio != rowCacheRatio )
+	{
+		clearRowCache();
+
+		rowCacheWidth = width;
+		rowCacheRatio = ratio;
+	}
+
+	const QPixmap * pixmap = rowCache->object( row );
+
+	if( pixmap && pixmap->size() == oriented( QSize( width, height ) ) * ratio )
+		return pixmap;
+
+	return renderRow( row, width, height );
+}
+
+template< typename T >
+inline
+const QPixmap *
+AbstractListViewPrivate< T >::renderRow( int row, int width, int height )
+{
+	if( width <= 0 || height <= 0 || rowCacheRatio <= 0.0 )
+		return 0;
+
+	AbstractListView< T > * q = q_func();
+
+	const QSize size = oriented( QSize( width, height ) );
+
+	QPixmap * pixmap = new QPixmap( size * rowCacheRatio );
+	pixmap->setDevicePixelRatio( rowCacheRatio );
+	pixmap->fill( Qt::transparent );
+
+	{
+		QPainter p( pixmap );
+		p.setFont( viewport->font() );
+		p.setPen( viewport->palette().color( QPalette::WindowText ) );
+		p.setRenderHint( QPainter::SmoothPixmapTransform,
+			!q->isInteracting() );
+
+		q->drawRow( &p, QRect( QPoint( 0, 0 ), size ), row );
+	}
+
+	// Draft rows are dropped when interaction finished.
+	if( q->isInteracting() )
+		draftRows.insert( row );
+	else
+		draftRows.remove( row );
+
+	if( !rowCache->insert( row, pixmap, estimatedBytes( *pixmap ) ) )
+		return 0;
+
+	return pixmap;
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::schedulePrerender( int firstRow, int lastRow )
+{
+	const AbstractListView< T > * q = q_func();
+
+	int above = 0;
+	int below = 0;
+
+	prerenderRange( q->rowHeightForWidth( firstRow, rowCacheWidth ),
+		&above, &below );
+
+	const int count = model->rowCount();
+
+	QVector< int > rows;
+
+	// Nearest rows first.
+	for( int i = 1; i <= qMax( above, below ); ++i )
+	{
+		if( i <= below && lastRow + i < count &&
+			!rowCache->contains( lastRow + i ) )
+				rows.append( lastRow + i );
+
+		if( i <= above && firstRow - i >= 0 &&
+			!rowCache->contains( firstRow - i ) )
+				rows.append( firstRow - i );
+	}
+
+	IdleScheduler * scheduler = IdleScheduler::instance();
+
+	prerenderJob.rows = rows;
+
+	if( !rows.isEmpty() )
+		scheduler->post( &prerenderJob );
+	else if( prerenderJob.isPending() )
+		scheduler->cancel( &prerenderJob );
+}
+
+template< typename T >
+inline
+bool
+AbstractListViewPrivate< T >::prerenderRows( const QDeadlineTimer & sliceEnd,
+	QVector< int > & rows )
+{
+	if( !rowCache || !model )
+		return true;
+
+	const AbstractListView< T > * q = q_func();
+	const int count = model->rowCount();
+
+	while( !rows.isEmpty() )
+	{
+		const int row = rows.takeFirst();
+
+		if( row < count && !rowCache->contains( row ) )
+			renderRow( row, rowCacheWidth,
+				q->rowHeightForWidth( row, rowCacheWidth ) );
+
+		if( sliceEnd.hasExpired() )
+			break;
+	}
+
+	return rows.isEmpty();
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::anchorToFirstVisibleRow()
+{
+	if( firstVisibleRow >= 0 && firstVisibleRow < heights.count() )
+		topLeftCorner = scrollPoint( static_cast< int > (
+			heights.offset( firstVisibleRow ) ) - offset );
+}
+
+template< typename T >
+inline
+int
+AbstractListViewPrivate< T >::headerExtent( int row, int width ) const
+{
+	const AbstractListView< T > * q = q_func();
+
+	if( q->isSectionStart( row ) )
+		return q->sectionHeaderHeightForWidth( row, width ) + spacing;
+	else
+		return 0;
+}
+
+template< typename T >
+inline
+int
+AbstractListViewPrivate< T >::rowExtent( int row, int width ) const
+{
+	const AbstractListView< T > * q = q_func();
+
+	return headerExtent( row, width ) +
+		q->rowHeightForWidth( row, width ) + spacing;
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::rebuildSections()
+{
+	const AbstractListView< T > * q = q_func();
+
+	sections.clear();
+
+	const int count = ( model ? model->rowCount() : 0 );
+
+	for( int i = 0; i < count; ++i )
+	{
+		if( q->isSectionStart( i ) )
+			sections.append( i );
+	}
+
+	invalidateStickyHeader();
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::updateSections( int firstRow, int lastRow )
+{
+	const AbstractListView< T > * q = q_func();
+
+	for( int i = firstRow; i <= lastRow; ++i )
+	{
+		const bool start = q->isSectionStart( i );
+
+		QVector< int >::iterator it =
+			std::lower_bound( sections.begin(), sections.end(), i );
+
+		const bool found = ( it != sections.end() && *it == i );
+
+		if( start && !found )
+			sections.insert( it, i );
+		else if( !start && found )
+			sections.erase( it );
+	}
+
+	invalidateStickyHeader();
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::shiftSections( int row, int delta )
+{
+	for( QVector< int >::iterator it = std::lower_bound( sections.begin(),
+		sections.end(), row ); it != sections.end(); ++it )
+			*it += delta;
+
+	invalidateStickyHeader();
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::removeSections( int firstRow, int lastRow )
+{
+	sections.erase(
+		std::lower_bound( sections.begin(), sections.end(), firstRow ),
+		std::upper_bound( sections.begin(), sections.end(), lastRow ) );
+
+	invalidateStickyHeader();
+}
+
+template< typename T >
+inline
+int
+AbstractListViewPrivate< T >::sectionOf( int row ) const
+{
+	if( row < 0 )
+		return -1;
+
+	QVector< int >::const_iterator it = std::upper_bound(
+		sections.constBegin(), sections.constEnd(), row );
+
+	return ( it == sections.constBegin() ? -1 : *( it - 1 ) );
+}
+
+template< typename T >
+inline
+const QPixmap &
+AbstractListViewPrivate< T >::stickyHeader( int section, int width )
+{
+	if( section == stickySection && width == stickyWidth &&
+		stickyPixmap.devicePixelRatio() == viewport->devicePixelRatioF() )
+			return stickyPixmap;
+
+	AbstractListView< T > * q = q_func();
+
+	stickySection = section;
+	stickyWidth = width;
+	stickyPixmap = QPixmap();
+
+	const int height = q->sectionHeaderHeightForWidth( section, width );
+
+	if( width > 0 && height > 0 )
+	{
+		const qreal ratio = viewport->devicePixelRatioF();
+		const QSize size = oriented( QSize( width, height ) );
+
+		stickyPixmap = QPixmap( size * ratio );
+		stickyPixmap.setDevicePixelRatio( ratio );
+		stickyPixmap.fill( Qt::transparent );
+
+		QPainter p( &stickyPixmap );
+		p.setFont( viewport->font() );
+		p.setPen( viewport->palette().color( QPalette::WindowText ) );
+
+		q->drawSectionHeader( &p, QRect( QPoint( 0, 0 ), size ), section );
+	}
+
+	return stickyPixmap;
+}
+
+template< typename T >
+inline
+int
+AbstractListViewPrivate< T >::stickyHeaderBottom( int width ) const
+{
+	const AbstractListView< T > * q = q_func();
+
+	const int section = sectionOf( firstVisibleRow );
+
+	if( section < 0 )
+		return 0;
+
+	int bottom = spacing + q->sectionHeaderHeightForWidth( section, width );
+
+	QVector< int >::const_iterator it = std::upper_bound(
+		sections.constBegin(), sections.constEnd(), firstVisibleRow );
+
+	if( it != sections.constEnd() )
+	{
+		// Top of the next header as it's drawn.
+		int y = offset + spacing;
+
+		for( int row = firstVisibleRow; row < *it && y < bottom + spacing; ++row )
+			y += rowExtent( row, width );
+
+		bottom = qMin( bottom, y - spacing );
+	}
+
+	return bottom;
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::invalidateStickyHeader()
+{
+	stickySection = -1;
+	stickyPixmap = QPixmap();
+}
+
+template< typename T >
+inline
+void
+AbstractListViewPrivate< T >::repaintRows( int firstRow, int lastRow )
+{
+	AbstractListView< T > * q = q_func();
+
+	if( !model || firstVisibleRow < 0 || lastRow < firstVisibleRow )
+		return;
+
+	const QRect r = layoutRect();
+	const int count = model->rowCount();
+	int lastVisibleRow = -1;
+
+	// With the heights index rows out of the viewport cost nothing.
+	if( isHeightsValid( count ) )
+	{
+		lastVisibleRow = qMin( count - 1, heights.rowAt(
+			heights.offset( firstVisibleRow ) - offset + r.height() ) );
+
+		const int estimated = heights.nextEstimated( firstVisibleRow );
+
+		if( estimated != -1 && estimated <= lastVisibleRow )
+			lastVisibleRow = -1;
+	}
+
+	if( lastVisibleRow == -1 )
+	{
+		const QVector< int > rows = visibleRows();
+
+		if( rows.isEmpty() )
+			return;
+
+		lastVisibleRow = rows.last();
+	}
+
+	const int from = qMax( firstRow, firstVisibleRow );
+	const int to = qMin( lastRow, lastVisibleRow );
+
+	if( from > to )
+		return;
+
+	const int x = r.x() + spacing;
+	const int width = r.width() - spacing * 2;
+	int y = r.y() + offset;
+
+	for( int row = firstVisibleRow; row <= to; ++row )
+	{
+		if( row < from )
+			y += rowExtent( row, width );
+		else
+		{
+			y += headerExtent( row, width );
+
+			const int height = q->rowHeightForWidth( row, width );
+
+			viewport->update( oriented( r.intersected(
+				QRect( x, y, width, height ) ) ) );
+
+			y += height + spacing;
+		}
+	}
+}
+
+template< typename T >
+inline
+int
+AbstractListViewPrivate< T >::rowCount() const
+{
+	return ( model ? model->rowCount() : 0 );
+}
+
+template< typename T >
+inline
+QVector< int >
+AbstractListViewPrivate< T >::visibleRows() const
+{
+	QVector< int > rows;
+
+	if( !model || firstVisibleRow < 0 )
+		return rows;
+
+	const QRect r = layoutRect();
+	const int width = r.width() - spacing * 2;
+	int y = offset;
+
+	for( int row = firstVisibleRow; row < model->rowCount() &&
+		y < r.height(); ++row )
+	{
+		rows.append( row );
+
+		y += rowExtent( row, width );
+	}
+
+	return rows;
+}
+
+template< typename T >
+inline
+QRect
+AbstractListViewPrivate< T >::rowRect( int row ) const
+{
+	const AbstractListView< T > * q = q_func();
 
-	return QSize( width, height );
+	return q->visualRect( row );
 }
 
 template< typename T >
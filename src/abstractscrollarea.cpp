@@ -9,6 +9,7 @@
 #include "private/abstractscrollarea_p.hpp"
 #include "scroller.hpp"
 #include "fingergeometry.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QStyleOption>
@@ -37,6 +38,7 @@ ScrollIndicator::ScrollIndicator( const QColor & c, Qt::Orientation o,
 	,	orientation( o )
 	,	needPaint( false )
 	,	color( c )
+	,	pen( c, width, Qt::SolidLine, Qt::RoundCap )
 	,	animate( false )
 	,	alpha( 255 )
 {
@@ -60,6 +62,13 @@ ScrollIndicator::sizeHint() const
 		return QSize( width, size );
 }
 
+void
+ScrollIndicator::setColor( const QColor & c )
+{
+	color = c;
+	pen.setColor( c );
+}
+
 void
 ScrollIndicator::paintEvent( QPaintEvent * )
 {
@@ -72,7 +81,7 @@ ScrollIndicator::paintEvent( QPaintEvent * )
 				break;
 			[[fallthrough]];
 		case AbstractScrollArea::ScrollIndicatorAlwaysOn :
-			drawIndicator( &p, color );
+			drawIndicator( &p );
 		break;
 
 		default:
@@ -81,16 +90,22 @@ ScrollIndicator::paintEvent( QPaintEvent * )
 }
 
 void
-ScrollIndicator::drawIndicator( QPainter * p, const QColor & c )
+ScrollIndicator::drawIndicator( QPainter * p )
 {
 	if( policy != AbstractScrollArea::ScrollIndicatorAlwaysOff )
 	{
-		QColor paintColor = c;
-
 		if( animate && policy != AbstractScrollArea::ScrollIndicatorAlwaysOn )
+		{
+			QColor paintColor = color;
 			paintColor.setAlpha( alpha );
 
-		p->setPen( QPen( paintColor, width, Qt::SolidLine, Qt::RoundCap ) );
+			QPen fadingPen = pen;
+			fadingPen.setColor( paintColor );
+
+			p->setPen( fadingPen );
+		}
+		else
+			p->setPen( pen );
 
 		const int middle = width / 2;
 
@@ -114,6 +129,7 @@ BlurEffect::BlurEffect( const QColor & c, Qt::Orientation o, QWidget * parent )
 	,	pressure( 0 )
 	,	darkBlurWidth( 4 )
 	,	maxPressure( 20.0 )
+	,	interacting( false )
 {
 }
 
@@ -135,8 +151,12 @@ BlurEffect::sizeHint() const
 void
 BlurEffect::paintEvent( QPaintEvent * )
 {
+	if( !RenderingQuality::decorations() )
+		return;
+
 	QPainter p( this );
-	p.setRenderHint( QPainter::Antialiasing );
+	p.setRenderHint( QPainter::Antialiasing,
+		RenderingQuality::antialiasing() && !interacting );
 
 	switch( policy )
 	{
@@ -189,6 +209,161 @@ BlurEffect::drawBlur( QPainter * p, const QColor & c )
 }
 
 
+//
+// Scrubber
+//
+
+Scrubber::Scrubber( AbstractScrollAreaPrivate * dd, const QColor & c,
+	QWidget * parent )
+	:	QWidget( parent )
+	,	d( dd )
+	,	color( c )
+	,	pressed( false )
+{
+}
+
+QSize
+Scrubber::sizeHint() const
+{
+	return QSize( FingerGeometry::width() / 2, FingerGeometry::height() );
+}
+
+void
+Scrubber::paintEvent( QPaintEvent * )
+{
+	QPainter p( this );
+	p.setRenderHint( QPainter::Antialiasing,
+		RenderingQuality::antialiasing() && !d->interacting );
+
+	const QRect r = rect();
+	const int middle = r.width() / 2;
+	const int thumb = r.width() / 2;
+
+	QColor trackColor = color;
+	trackColor.setAlpha( pressed ? 160 : 80 );
+
+	p.setPen( QPen( trackColor, 3, Qt::SolidLine, Qt::RoundCap ) );
+	p.drawLine( middle, thumb / 2, middle, r.height() - thumb / 2 );
+
+	const int range = d->scrolledAreaSize.height() - d->viewport->height();
+	const qreal fraction = ( range > 0 ?
+		qBound( 0.0, (qreal) d->topLeftCorner.y() / range, 1.0 ) : 0.0 );
+
+	p.setPen( Qt::NoPen );
+	p.setBrush( color );
+	p.drawEllipse( QRect( middle - thumb / 2,
+		qRound( fraction * ( r.height() - thumb ) ), thumb, thumb ) );
+}
+
+void
+Scrubber::mousePressEvent( QMouseEvent * e )
+{
+	if( e->button() == Qt::LeftButton )
+	{
+		pressed = true;
+
+		d->scrubTo( e->pos().y() );
+
+		e->accept();
+	}
+	else
+		e->ignore();
+}
+
+void
+Scrubber::mouseMoveEvent( QMouseEvent * e )
+{
+	if( pressed )
+	{
+		d->scrubTo( e->pos().y() );
+
+		e->accept();
+	}
+	else
+		e->ignore();
+}
+
+void
+Scrubber::mouseReleaseEvent( QMouseEvent * e )
+{
+	if( e->button() == Qt::LeftButton && pressed )
+	{
+		pressed = false;
+
+		d->finishScrubbing();
+
+		update();
+
+		e->accept();
+	}
+	else
+		e->ignore();
+}
+
+
+//
+// ScrubberLabel
+//
+
+ScrubberLabel::ScrubberLabel( const QColor & c, QWidget * parent )
+	:	QWidget( parent )
+	,	color( c )
+	,	interacting( false )
+{
+	QFont f = font();
+
+	if( f.pointSizeF() > 0.0 )
+		f.setPointSizeF( f.pointSizeF() * 2.0 );
+	else
+		f.setPixelSize( f.pixelSize() * 2 );
+
+	setFont( f );
+
+	setAttribute( Qt::WA_TransparentForMouseEvents );
+}
+
+QSize
+ScrubberLabel::sizeHint() const
+{
+	const QSize s = fontMetrics().boundingRect( text ).size() +
+		QSize( FingerGeometry::width() / 2, FingerGeometry::height() / 2 );
+
+	return QSize( qMax( s.width(), FingerGeometry::height() ),
+		qMax( s.height(), FingerGeometry::height() ) );
+}
+
+void
+ScrubberLabel::setText( const QString & t )
+{
+	if( text != t )
+	{
+		text = t;
+
+		update();
+	}
+}
+
+void
+ScrubberLabel::paintEvent( QPaintEvent * )
+{
+	QPainter p( this );
+	p.setRenderHint( QPainter::Antialiasing,
+		RenderingQuality::antialiasing() && !interacting );
+
+	QColor background = color;
+	background.setAlpha( 200 );
+
+	const int radius = qMin( width(), height() ) / 4;
+
+	p.setPen( Qt::NoPen );
+	p.setBrush( background );
+	p.drawRoundedRect( rect(), radius, radius );
+
+	p.setPen( palette().color( QPalette::HighlightedText ) );
+	p.drawText( rect(), Qt::AlignCenter, text );
+}
+
+
 //
 // AbstractScrollAreaPrivate
 //
@@ -199,7 +374,8 @@ AbstractScrollAreaPrivate::init()
 	QStyleOption opt;
 	opt.initFrom( q );
 
-	const QColor ic = opt.palette.color( QPalette::Highlight );
+	indicatorColor = opt.palette.color( QPalette::Highlight );
+	blurColor = indicatorColor;
 
 	viewport = new QWidget( q );
 	viewport->setObjectName( QLatin1String( "qt_scrollarea_viewport" ) );
@@ -208,25 +384,7 @@ AbstractScrollAreaPrivate::init()
 	viewport->setFocusProxy( q );
 	viewport->setContentsMargins( 0, 0, 0, 0 );
 
-	horIndicator = new ScrollIndicator( ic, Qt::Horizontal, viewport );
-	vertIndicator = new ScrollIndicator( ic, Qt::Vertical, viewport );
-
-	horBlur = new BlurEffect( ic, Qt::Vertical, viewport );
-	vertBlur = new BlurEffect( ic, Qt::Horizontal, viewport );
-
-	horBlurAnim = new QVariantAnimation( q );
-	horBlurAnim->setDuration( 300 );
-	horBlurAnim->setLoopCount( 1 );
-
-	vertBlurAnim = new QVariantAnimation( q );
-	vertBlurAnim->setDuration( 300 );
-	vertBlurAnim->setLoopCount( 1 );
-
-	animationTimer = new QTimer( q );
-	animationTimer->setSingleShot( true );
-
-	startBlurAnimTimer = new QTimer( q );
-	startBlurAnimTimer->setSingleShot( true );
+	helpersParent = viewport;
 
 	scroller = new Scroller( q, q );
 
@@ -250,10 +408,19 @@ AbstractScrollAreaPrivate::layoutChildren( const QStyleOption & opt )
 	viewport->setGeometry( QStyle::visualRect( opt.direction, opt.rect,
 		viewportRect ) );
 
+	layoutBlur();
+}
+
+void
+AbstractScrollAreaPrivate::layoutBlur()
+{
+	if( !horBlur )
+		return;
+
 	horBlur->resize( horBlur->sizeHint().width(),
-		viewportRect.height() * 0.75 );
+		viewport->height() * 0.75 );
 
-	vertBlur->resize( viewportRect.width() * 0.75,
+	vertBlur->resize( viewport->width() * 0.75,
 		vertBlur->sizeHint().height() );
 }
 
@@ -291,6 +458,9 @@ AbstractScrollAreaPrivate::normalizePosition()
 void
 AbstractScrollAreaPrivate::calcIndicators()
 {
+	if( !horIndicator )
+		return;
+
 	if( scrolledAreaSize.isValid() && scrolledAreaSize.width() != 0
 		&& scrolledAreaSize.height() != 0 )
 	{
@@ -332,7 +502,7 @@ AbstractScrollAreaPrivate::calcIndicator( Qt::Orientation orient,
 			scrolledSize = scrolledAreaSize.width();
 			x = 2 * width;
 			y = qMin( viewport->height(), scrolledAreaSize.height() ) - x;
-			y += ( horIndicator->parent() == viewport ? 0 : topLeftCorner.y() );
+			y += ( helpersParent == viewport ? 0 : topLeftCorner.y() );
 			posRatio = (double) topLeftCorner.x() / (double) scrolledSize;
 			totalIndicatorSize = qMin( viewportSize, scrolledSize ) - 4 * width;
 			ratio = (double) viewportSize / (double) scrolledSize;
@@ -349,7 +519,7 @@ AbstractScrollAreaPrivate::calcIndicator( Qt::Orientation orient,
 				}
 
 				x += totalIndicatorSize * deltaRatio
-					+ ( horIndicator->parent() == viewport ? 0 : scrolledSize )
+					+ ( helpersParent == viewport ? 0 : scrolledSize )
 					* posRatio;
 			}
 			else
@@ -368,7 +538,7 @@ AbstractScrollAreaPrivate::calcIndicator( Qt::Orientation orient,
 			scrolledSize = scrolledAreaSize.height();
 			y = 2 * width;
 			x = qMin( viewport->width(), scrolledAreaSize.width() ) - y;
-			x += ( vertIndicator->parent() == viewport ? 0 : topLeftCorner.x() );
+			x += ( helpersParent == viewport ? 0 : topLeftCorner.x() );
 			posRatio = (double) topLeftCorner.y() / (double) scrolledSize;
 			totalIndicatorSize = qMin( viewportSize, scrolledSize ) - 4 * width;
 			ratio = (double) viewportSize / (double) scrolledSize;
@@ -385,7 +555,7 @@ AbstractScrollAreaPrivate::calcIndicator( Qt::Orientation orient,
 				}
 
 				y += totalIndicatorSize * deltaRatio
-					+ ( vertIndicator->parent() == viewport ? 0 : scrolledSize )
+					+ ( helpersParent == viewport ? 0 : scrolledSize )
 					* posRatio;
 			}
 			else
@@ -405,6 +575,9 @@ AbstractScrollAreaPrivate::scrollContentsBy( int dx, int dy )
 {
 	topLeftCorner -= QPoint( dx, dy );
 
+	if( dx != 0 || dy != 0 )
+		ensureIndicators();
+
 	if( dx != 0 )
 	{
 		horIndicator->needPaint = true;
@@ -412,7 +585,8 @@ AbstractScrollAreaPrivate::scrollContentsBy( int dx, int dy )
 		horIndicator->animate = false;
 		vertIndicator->alpha = vertIndicator->color.alpha();
 		vertIndicator->animate = false;
-		animationTimer->stop();
+		if( animationTimer )
+			animationTimer->stop();
 		horIndicator->raise();
 	}
 
@@ -423,7 +597,8 @@ AbstractScrollAreaPrivate::scrollContentsBy( int dx, int dy )
 		vertIndicator->animate = false;
 		horIndicator->alpha = horIndicator->color.alpha();
 		horIndicator->animate = false;
-		animationTimer->stop();
+		if( animationTimer )
+			animationTimer->stop();
 		vertIndicator->raise();
 	}
 
@@ -431,15 +606,22 @@ AbstractScrollAreaPrivate::scrollContentsBy( int dx, int dy )
 
 	calcIndicators();
 
+	if( scrubber )
+		scrubber->update();
+
 	q->update();
-	horIndicator->update();
-	vertIndicator->update();
+
+	if( horIndicator )
+	{
+		horIndicator->update();
+		vertIndicator->update();
+	}
 }
 
 void
 AbstractScrollAreaPrivate::makeBlurEffectIfNeeded()
 {
-	if( horBlur->policy != AbstractScrollArea::BlurAlwaysOff )
+	if( blurPolicy != AbstractScrollArea::BlurAlwaysOff )
 	{
 		const QRect r = viewport->rect();
 
@@ -452,6 +634,15 @@ AbstractScrollAreaPrivate::makeBlurEffectIfNeeded()
 		const QPoint maxPos = QPoint( scrolledAreaSize.width() - s.width(),
 			scrolledAreaSize.height() - s.height() );
 
+		if( !horBlur )
+		{
+			if( p.x() < 0 || p.y() < 0 ||
+				maxPos.x() < p.x() || maxPos.y() < p.y() )
+					ensureBlur();
+			else
+				return;
+		}
+
 		if( p.x() < 0 || ( horBlur->pressure < 0 && maxPos.x() >= p.x() ) )
 		{
 			if( horBlur->pressure <= 0 && horBlur->pressure + p.x() > 0 )
@@ -463,9 +654,9 @@ AbstractScrollAreaPrivate::makeBlurEffectIfNeeded()
 				horBlur->pressure += p.x();
 
 			horBlur->move(
-				( horBlur->parent() == viewport ? r.x() : topLeftCorner.x() )
+				( helpersParent == viewport ? r.x() : topLeftCorner.x() )
 					- horBlur->width() / 2,
-				( horBlur->parent() == viewport ? r.y() : topLeftCorner.y() )
+				( helpersParent == viewport ? r.y() : topLeftCorner.y() )
 					+ ( r.height() - horBlur->height() ) / 2 );
 		}
 
@@ -480,9 +671,9 @@ AbstractScrollAreaPrivate::makeBlurEffectIfNeeded()
 				vertBlur->pressure += p.y();
 
 			vertBlur->move(
-				( vertBlur->parent() == viewport ? r.x() : topLeftCorner.x() )
+				( helpersParent == viewport ? r.x() : topLeftCorner.x() )
 					+ ( r.width() - vertBlur->width() ) / 2,
-				( vertBlur->parent() == viewport ? r.y() : topLeftCorner.y() )
+				( helpersParent == viewport ? r.y() : topLeftCorner.y() )
 					- vertBlur->height() / 2 );
 		}
 
@@ -498,9 +689,9 @@ AbstractScrollAreaPrivate::makeBlurEffectIfNeeded()
 				horBlur->pressure += ( p.x() - maxPos.x() );
 
 			horBlur->move(
-				( horBlur->parent() == viewport ? r.x() : topLeftCorner.x() )
+				( helpersParent == viewport ? r.x() : topLeftCorner.x() )
 					+ r.width() - horBlur->width() / 2,
-				( horBlur->parent() == viewport ? r.y() : topLeftCorner.y() )
+				( helpersParent == viewport ? r.y() : topLeftCorner.y() )
 					+ ( r.height() - horBlur->height() ) / 2 );
 		}
 
@@ -516,9 +707,9 @@ AbstractScrollAreaPrivate::makeBlurEffectIfNeeded()
 				vertBlur->pressure += ( p.y() - maxPos.y() );
 
 			vertBlur->move(
-				( vertBlur->parent() == viewport ? r.x() : topLeftCorner.x() )
+				( helpersParent == viewport ? r.x() : topLeftCorner.x() )
 					+ ( r.width() - vertBlur->width() ) / 2,
-				( vertBlur->parent() == viewport ? r.y() : topLeftCorner.y() )
+				( helpersParent == viewport ? r.y() : topLeftCorner.y() )
 					+ r.height() - vertBlur->height() / 2 );
 		}
 
@@ -547,6 +738,9 @@ AbstractScrollAreaPrivate::makeBlurEffectIfNeeded()
 void
 AbstractScrollAreaPrivate::animateHiddingBlurEffect()
 {
+	if( !horBlur )
+		return;
+
 	horBlurAnim->setStartValue( horBlur->pressure );
 	horBlurAnim->setEndValue( 0 );
 	vertBlurAnim->setStartValue( vertBlur->pressure );
@@ -562,6 +756,9 @@ AbstractScrollAreaPrivate::animateHiddingBlurEffect()
 void
 AbstractScrollAreaPrivate::stopAnimatingBlurEffect()
 {
+	if( !horBlur )
+		return;
+
 	horBlurAnim->stop();
 	vertBlurAnim->stop();
 }
@@ -569,6 +766,11 @@ AbstractScrollAreaPrivate::stopAnimatingBlurEffect()
 void
 AbstractScrollAreaPrivate::animateScrollIndicators()
 {
+	if( !horIndicator )
+		return;
+
+	ensureAnimationTimer();
+
 	animationTimer->stop();
 	horIndicator->alpha = horIndicator->color.alpha();
 	vertIndicator->alpha = vertIndicator->color.alpha();
@@ -590,7 +792,12 @@ AbstractScrollAreaPrivate::animateScrollIndicators()
 void
 AbstractScrollAreaPrivate::stopScrollIndicatorsAnimation()
 {
-	animationTimer->stop();
+	if( animationTimer )
+		animationTimer->stop();
+
+	if( !horIndicator )
+		return;
+
 	horIndicator->needPaint = false;
 	vertIndicator->needPaint = false;
 	horIndicator->animate = false;
@@ -599,6 +806,286 @@ AbstractScrollAreaPrivate::stopScrollIndicatorsAnimation()
 	vertIndicator->update();
 }
 
+void
+AbstractScrollAreaPrivate::ensureIndicators()
+{
+	if( horIndicator )
+		return;
+
+	horIndicator = new ScrollIndicator( indicatorColor, Qt::Horizontal,
+		helpersParent );
+	horIndicator->policy = horIndicatorPolicy;
+
+	vertIndicator = new ScrollIndicator( indicatorColor, Qt::Vertical,
+		helpersParent );
+	vertIndicator->policy = vertIndicatorPolicy;
+
+	calcIndicators();
+
+	if( helpersParent )
+	{
+		horIndicator->show();
+		vertIndicator->show();
+	}
+}
+
+void
+AbstractScrollAreaPrivate::ensureAnimationTimer()
+{
+	if( animationTimer )
+		return;
+
+	animationTimer = new QTimer( q );
+	animationTimer->setSingleShot( true );
+
+	QObject::connect( animationTimer, &QTimer::timeout,
+		q, &AbstractScrollArea::_q_animateScrollIndicators );
+}
+
+void
+AbstractScrollAreaPrivate::ensureBlur()
+{
+	if( horBlur )
+		return;
+
+	horBlur = new BlurEffect( blurColor, Qt::Vertical, helpersParent );
+	horBlur->policy = blurPolicy;
+	horBlur->interacting = interacting;
+	horBlur->hide();
+
+	vertBlur = new BlurEffect( blurColor, Qt::Horizontal, helpersParent );
+	vertBlur->policy = blurPolicy;
+	vertBlur->interacting = interacting;
+	vertBlur->hide();
+
+	layoutBlur();
+
+	horBlurAnim = new QVariantAnimation( q );
+	horBlurAnim->setDuration( 300 );
+	horBlurAnim->setLoopCount( 1 );
+
+	vertBlurAnim = new QVariantAnimation( q );
+	vertBlurAnim->setDuration( 300 );
+	vertBlurAnim->setLoopCount( 1 );
+
+	QObject::connect( horBlurAnim, &QVariantAnimation::valueChanged,
+		q, &AbstractScrollArea::_q_horBlurAnim );
+
+	QObject::connect( horBlurAnim, &QVariantAnimation::finished,
+		q, &AbstractScrollArea::_q_horBlurAnimFinished );
+
+	QObject::connect( vertBlurAnim, &QVariantAnimation::valueChanged,
+		q, &AbstractScrollArea::_q_vertBlurAnim );
+
+	QObject::connect( vertBlurAnim, &QVariantAnimation::finished,
+		q, &AbstractScrollArea::_q_vertBlurAnimFinished );
+}
+
+void
+AbstractScrollAreaPrivate::ensureStartBlurAnimTimer()
+{
+	if( startBlurAnimTimer )
+		return;
+
+	startBlurAnimTimer = new QTimer( q );
+	startBlurAnimTimer->setSingleShot( true );
+
+	QObject::connect( startBlurAnimTimer, &QTimer::timeout,
+		q, &AbstractScrollArea::_q_startBlurAnim );
+}
+
+void
+AbstractScrollAreaPrivate::ensureWheelInteractionTimer()
+{
+	if( wheelInteractionTimer )
+		return;
+
+	wheelInteractionTimer = new QTimer( q );
+	wheelInteractionTimer->setSingleShot( true );
+
+	QObject::connect( wheelInteractionTimer, &QTimer::timeout,
+		q, &AbstractScrollArea::_q_wheelInteractionFinished );
+}
+
+void
+AbstractScrollAreaPrivate::setInteracting( bool on )
+{
+	if( interacting == on )
+		return;
+
+	interacting = on;
+
+	if( horBlur )
+	{
+		horBlur->interacting = on;
+		vertBlur->interacting = on;
+	}
+
+	if( scrubberLabel )
+		scrubberLabel->interacting = on;
+
+	emit q->interactingChanged( on );
+
+	if( !on )
+	{
+		viewport->update();
+
+		if( helpersParent && helpersParent != viewport )
+			helpersParent->update();
+
+		if( scrubber && scrubber->isVisible() )
+			scrubber->update();
+	}
+}
+
+bool
+AbstractScrollAreaPrivate::indicatorsNeedPaint() const
+{
+	return ( horIndicator &&
+		( horIndicator->needPaint || vertIndicator->needPaint ) );
+}
+
+void
+AbstractScrollAreaPrivate::setHelpersParent( QWidget * parent )
+{
+	helpersParent = parent;
+
+	if( horIndicator )
+	{
+		horIndicator->setParent( parent );
+		vertIndicator->setParent( parent );
+
+		if( parent )
+		{
+			horIndicator->raise();
+			horIndicator->show();
+			vertIndicator->raise();
+			vertIndicator->show();
+		}
+	}
+
+	if( horBlur )
+	{
+		horBlur->setParent( parent );
+		vertBlur->setParent( parent );
+	}
+}
+
+qint64
+AbstractScrollAreaPrivate::helpersMemoryUsage() const
+{
+	qint64 bytes = 0;
+
+	if( horIndicator )
+		bytes += 2 * sizeof( ScrollIndicator );
+
+	if( animationTimer )
+		bytes += sizeof( QTimer );
+
+	if( horBlur )
+		bytes += 2 * ( sizeof( BlurEffect ) + sizeof( QVariantAnimation ) );
+
+	if( startBlurAnimTimer )
+		bytes += sizeof( QTimer );
+
+	if( wheelInteractionTimer )
+		bytes += sizeof( QTimer );
+
+	if( scrubber )
+		bytes += sizeof( Scrubber ) + sizeof( ScrubberLabel );
+
+	return bytes;
+}
+
+void
+AbstractScrollAreaPrivate::ensureScrubber()
+{
+	if( scrubber )
+		return;
+
+	scrubber = new Scrubber( this, indicatorColor, q );
+	scrubber->setObjectName( QLatin1String( "qt_scrollarea_scrubber" ) );
+	scrubber->hide();
+
+	scrubberLabel = new ScrubberLabel( indicatorColor, q );
+	scrubberLabel->interacting = interacting;
+	scrubberLabel->setObjectName(
+		QLatin1String( "qt_scrollarea_scrubber_label" ) );
+	scrubberLabel->hide();
+}
+
+void
+AbstractScrollAreaPrivate::layoutScrubber()
+{
+	if( !scrubber )
+		return;
+
+	if( !scrubberEnabled || scrolledAreaSize.height() <= viewport->height() )
+	{
+		scrubber->hide();
+		scrubberLabel->hide();
+
+		return;
+	}
+
+	const QRect r = viewport->geometry();
+	const int width = scrubber->sizeHint().width();
+
+	scrubber->setGeometry( ( q->isRightToLeft() ?
+			r.x() : r.x() + r.width() - width ),
+		r.y(), width, r.height() );
+	scrubber->raise();
+	scrubber->show();
+	scrubber->update();
+}
+
+void
+AbstractScrollAreaPrivate::scrubTo( int y )
+{
+	const int range = scrolledAreaSize.height() - viewport->height();
+
+	if( range <= 0 )
+		return;
+
+	const int thumb = scrubber->width() / 2;
+	const qreal fraction = qBound( 0.0, (qreal) ( y - thumb / 2 ) /
+		qMax( 1, scrubber->height() - thumb ), 1.0 );
+
+	setInteracting( true );
+
+	// Intermediate content is not scrolled through.
+	q->jumpToPosition( QPoint( topLeftCorner.x(),
+		qRound( fraction * range ) ) );
+
+	calcIndicators();
+
+	scrubber->update();
+
+	const QString text = q->scrubberLabel( topLeftCorner );
+
+	if( text.isEmpty() )
+		scrubberLabel->hide();
+	else
+	{
+		scrubberLabel->setText( text );
+
+		const QSize s = scrubberLabel->sizeHint();
+
+		scrubberLabel->setGeometry( QRect( viewport->geometry().center() -
+			QPoint( s.width() / 2, s.height() / 2 ), s ) );
+		scrubberLabel->raise();
+		scrubberLabel->show();
+	}
+}
+
+void
+AbstractScrollAreaPrivate::finishScrubbing()
+{
+	scrubberLabel->hide();
+
+	setInteracting( false );
+}
+
 
 //
 // AbstractScrollArea
@@ -610,12 +1097,6 @@ AbstractScrollArea::AbstractScrollArea( QWidget * parent )
 {
 	d->init();
 
-	connect( d->animationTimer, &QTimer::timeout,
-		this, &AbstractScrollArea::_q_animateScrollIndicators );
-
-	connect( d->startBlurAnimTimer, &QTimer::timeout,
-		this, &AbstractScrollArea::_q_startBlurAnim );
-
 	connect( d->scroller, &Scroller::scroll,
 		this, &AbstractScrollArea::_q_kineticScrolling );
 
@@ -624,18 +1105,6 @@ AbstractScrollArea::AbstractScrollArea( QWidget * parent )
 
 	connect( d->scroller, &Scroller::finished,
 		this, &AbstractScrollArea::_q_kineticScrollingFinished );
-
-	connect( d->horBlurAnim, &QVariantAnimation::valueChanged,
-		this, &AbstractScrollArea::_q_horBlurAnim );
-
-	connect( d->horBlurAnim, &QVariantAnimation::finished,
-		this, &AbstractScrollArea::_q_horBlurAnimFinished );
-
-	connect( d->vertBlurAnim, &QVariantAnimation::valueChanged,
-		this, &AbstractScrollArea::_q_vertBlurAnim );
-
-	connect( d->vertBlurAnim, &QVariantAnimation::finished,
-		this, &AbstractScrollArea::_q_vertBlurAnimFinished );
 }
 
 AbstractScrollArea::AbstractScrollArea( AbstractScrollAreaPrivate * dd,
@@ -645,12 +1114,6 @@ AbstractScrollArea::AbstractScrollArea( AbstractScrollAreaPrivate * dd,
 {
 	d->init();
 
-	connect( d->animationTimer, &QTimer::timeout,
-		this, &AbstractScrollArea::_q_animateScrollIndicators );
-
-	connect( d->startBlurAnimTimer, &QTimer::timeout,
-		this, &AbstractScrollArea::_q_startBlurAnim );
-
 	connect( d->scroller, &Scroller::scroll,
 		this, &AbstractScrollArea::_q_kineticScrolling );
 
@@ -659,18 +1122,6 @@ AbstractScrollArea::AbstractScrollArea( AbstractScrollAreaPrivate * dd,
 
 	connect( d->scroller, &Scroller::finished,
 		this, &AbstractScrollArea::_q_kineticScrollingFinished );
-
-	connect( d->horBlurAnim, &QVariantAnimation::valueChanged,
-		this, &AbstractScrollArea::_q_horBlurAnim );
-
-	connect( d->horBlurAnim, &QVariantAnimation::finished,
-		this, &AbstractScrollArea::_q_horBlurAnimFinished );
-
-	connect( d->vertBlurAnim, &QVariantAnimation::valueChanged,
-		this, &AbstractScrollArea::_q_vertBlurAnim );
-
-	connect( d->vertBlurAnim, &QVariantAnimation::finished,
-		this, &AbstractScrollArea::_q_vertBlurAnimFinished );
 }
 
 AbstractScrollArea::~AbstractScrollArea()
@@ -696,10 +1147,7 @@ AbstractScrollArea::setViewport( QWidget * widget )
 		d->viewport = widget;
 		d->viewport->setParent( this );
 		d->viewport->setFocusProxy( this );
-		d->horIndicator->setParent( d->viewport );
-		d->vertIndicator->setParent( d->viewport );
-		d->horBlur->setParent( d->viewport );
-		d->vertBlur->setParent( d->viewport );
+		d->setHelpersParent( d->viewport );
 
 		QStyleOption opt;
 		opt.initFrom( this );
@@ -728,79 +1176,174 @@ AbstractScrollArea::scroller() const
 QColor
 AbstractScrollArea::indicatorColor() const
 {
-	return d->horIndicator->color;
+	return d->indicatorColor;
 }
 
 void
 AbstractScrollArea::setIndicatorColor( const QColor & c )
 {
-	if( d->horIndicator->color != c )
+	if( d->indicatorColor != c )
 	{
-		d->horIndicator->color = c;
-		d->vertIndicator->color = c;
+		d->indicatorColor = c;
+
+		if( d->horIndicator )
+		{
+			d->horIndicator->setColor( c );
+			d->vertIndicator->setColor( c );
+		}
+
+		if( d->scrubber )
+		{
+			d->scrubber->color = c;
+			d->scrubber->update();
+			d->scrubberLabel->color = c;
+			d->scrubberLabel->update();
+		}
 	}
 }
 
 AbstractScrollArea::ScrollIndicatorPolicy
 AbstractScrollArea::verticalScrollIndicatorPolicy() const
 {
-	return d->vertIndicator->policy;
+	return d->vertIndicatorPolicy;
 }
 
 void
 AbstractScrollArea::setVerticalScrollIndicatorPolicy(
 	ScrollIndicatorPolicy policy )
 {
-	d->vertIndicator->policy = policy;
+	d->vertIndicatorPolicy = policy;
+
+	if( policy == ScrollIndicatorAlwaysOn )
+		d->ensureIndicators();
+
+	if( d->vertIndicator )
+	{
+		d->vertIndicator->policy = policy;
 
-	d->vertIndicator->update();
+		d->vertIndicator->update();
+	}
 }
 
 
 AbstractScrollArea::ScrollIndicatorPolicy
 AbstractScrollArea::horizontalScrollIndicatorPolicy() const
 {
-	return d->horIndicator->policy;
+	return d->horIndicatorPolicy;
 }
 
 void
 AbstractScrollArea::setHorizontalScrollIndicatorPolicy(
 	AbstractScrollArea::ScrollIndicatorPolicy policy )
 {
-	d->horIndicator->policy = policy;
+	d->horIndicatorPolicy = policy;
+
+	if( policy == ScrollIndicatorAlwaysOn )
+		d->ensureIndicators();
 
-	d->horIndicator->update();
+	if( d->horIndicator )
+	{
+		d->horIndicator->policy = policy;
+
+		d->horIndicator->update();
+	}
 }
 
 const QColor &
 AbstractScrollArea::blurColor() const
 {
-	return d->horBlur->color;
+	return d->blurColor;
 }
 
 void
 AbstractScrollArea::setBlurColor( const QColor & c )
 {
-	if( d->horBlur->color != c )
+	if( d->blurColor != c )
 	{
-		d->horBlur->color = c;
-		d->vertBlur->color = c;
+		d->blurColor = c;
+
+		if( d->horBlur )
+		{
+			d->horBlur->color = c;
+			d->vertBlur->color = c;
+		}
 	}
 }
 
 AbstractScrollArea::BlurPolicy
 AbstractScrollArea::blurPolicy() const
 {
-	return d->horBlur->policy;
+	return d->blurPolicy;
+}
+
+bool
+AbstractScrollArea::isInteracting() const
+{
+	return d->interacting;
+}
+
+bool
+AbstractScrollArea::isScrubberEnabled() const
+{
+	return d->scrubberEnabled;
+}
+
+void
+AbstractScrollArea::setScrubberEnabled( bool on )
+{
+	if( d->scrubberEnabled != on )
+	{
+		d->scrubberEnabled = on;
+
+		if( on )
+			d->ensureScrubber();
+
+		d->layoutScrubber();
+	}
+}
+
+void
+AbstractScrollArea::setScrubberLabelFunction( const ScrubberLabelFunction & f )
+{
+	d->scrubberLabelFunction = f;
+}
+
+MemoryUsage
+AbstractScrollArea::memoryUsage() const
+{
+	MemoryUsage u;
+	u.add( MemoryUsage::Data, widgetBytes( sizeof( AbstractScrollArea ) ) +
+		sizeof( AbstractScrollAreaPrivate ) );
+	u.add( MemoryUsage::Animations,
+		sizeof( Scroller ) + sizeof( QVariantAnimation ) );
+
+	if( d->animationTimer )
+		u.add( MemoryUsage::Animations, sizeof( QTimer ) );
+
+	if( d->startBlurAnimTimer )
+		u.add( MemoryUsage::Animations, sizeof( QTimer ) );
+
+	if( d->wheelInteractionTimer )
+		u.add( MemoryUsage::Animations, sizeof( QTimer ) );
+
+	if( d->horBlurAnim )
+		u.add( MemoryUsage::Animations, 2 * sizeof( QVariantAnimation ) );
+
+	return u;
 }
 
 void
 AbstractScrollArea::setBlurPolicy( BlurPolicy policy )
 {
-	if( d->horBlur->policy != policy )
+	if( d->blurPolicy != policy )
 	{
-		d->horBlur->policy = policy;
-		d->vertBlur->policy = policy;
+		d->blurPolicy = policy;
+
+		if( d->horBlur )
+		{
+			d->horBlur->policy = policy;
+			d->vertBlur->policy = policy;
+		}
 	}
 }
 
@@ -852,8 +1395,12 @@ AbstractScrollArea::setViewportMargins( int left, int top,
 	d->calcIndicators();
 
 	update();
-	d->horIndicator->update();
-	d->vertIndicator->update();
+
+	if( d->horIndicator )
+	{
+		d->horIndicator->update();
+		d->vertIndicator->update();
+	}
 }
 
 void
@@ -878,9 +1425,15 @@ AbstractScrollArea::setScrolledAreaSize( const QSize & s )
 
 	d->calcIndicators();
 
+	d->layoutScrubber();
+
 	update();
-	d->horIndicator->update();
-	d->vertIndicator->update();
+
+	if( d->horIndicator )
+	{
+		d->horIndicator->update();
+		d->vertIndicator->update();
+	}
 }
 
 const QPoint &
@@ -908,6 +1461,19 @@ AbstractScrollArea::startScrollIndicatorsAnimation()
 	d->animateScrollIndicators();
 }
 
+void
+AbstractScrollArea::jumpToPosition( const QPoint & topLeft )
+{
+	setTopLeftPointShownArea( topLeft );
+}
+
+QString
+AbstractScrollArea::scrubberLabel( const QPoint & topLeft ) const
+{
+	return ( d->scrubberLabelFunction ?
+		d->scrubberLabelFunction( topLeft ) : QString() );
+}
+
 void
 AbstractScrollArea::resizeEvent( QResizeEvent * e )
 {
@@ -917,6 +1483,7 @@ AbstractScrollArea::resizeEvent( QResizeEvent * e )
 	d->layoutChildren( opt );
 	d->normalizePosition();
 	d->calcIndicators();
+	d->layoutScrubber();
 
 	update();
 
@@ -930,6 +1497,7 @@ AbstractScrollArea::mousePressEvent( QMouseEvent * e )
 	{
 		d->mousePos = e->pos();
 		d->leftMouseButtonPressed = true;
+		d->kineticScrolling = false;
 		d->stopScrollIndicatorsAnimation();
 
 		e->accept();
@@ -945,9 +1513,12 @@ AbstractScrollArea::mouseReleaseEvent( QMouseEvent * e )
 	{
 		d->leftMouseButtonPressed = false;
 
-		if( ( d->horIndicator->needPaint || d->vertIndicator->needPaint ) &&
-			( d->horIndicator->policy == ScrollIndicatorAsNeeded ||
-				d->vertIndicator->policy == ScrollIndicatorAsNeeded ) )
+		if( !d->kineticScrolling )
+			d->setInteracting( false );
+
+		if( d->indicatorsNeedPaint() &&
+			( d->horIndicatorPolicy == ScrollIndicatorAsNeeded ||
+				d->vertIndicatorPolicy == ScrollIndicatorAsNeeded ) )
 					d->animateScrollIndicators();
 		else
 			d->stopScrollIndicatorsAnimation();
@@ -970,6 +1541,9 @@ AbstractScrollArea::mouseMoveEvent( QMouseEvent * e )
 
 		d->mousePos = e->pos();
 
+		if( dx != 0 || dy != 0 )
+			d->setInteracting( true );
+
 		d->scrollContentsBy( dx, dy );
 
 		scrollContentsBy( dx, dy );
@@ -988,6 +1562,10 @@ AbstractScrollArea::wheelEvent( QWheelEvent * e )
 
 	d->stopAnimatingBlurEffect();
 
+	d->setInteracting( true );
+	d->ensureWheelInteractionTimer();
+	d->wheelInteractionTimer->start( d->animationTimeout );
+
 	if( !numPixels.isNull() )
 	{
 		if( e->modifiers() == Qt::ShiftModifier )
@@ -1015,12 +1593,16 @@ AbstractScrollArea::wheelEvent( QWheelEvent * e )
 		}
 	}
 
-	if( d->horIndicator->policy == ScrollIndicatorAsNeeded ||
-		d->vertIndicator->policy == ScrollIndicatorAsNeeded )
+	if( d->horIndicatorPolicy == ScrollIndicatorAsNeeded ||
+		d->vertIndicatorPolicy == ScrollIndicatorAsNeeded )
 			d->animateScrollIndicators();
 
-	d->startBlurAnimTimer->stop();
-	d->startBlurAnimTimer->start( d->animationTimeout );
+	if( d->horBlur )
+	{
+		d->ensureStartBlurAnimTimer();
+		d->startBlurAnimTimer->stop();
+		d->startBlurAnimTimer->start( d->animationTimeout );
+	}
 
 	e->accept();
 }
@@ -1053,6 +1635,9 @@ AbstractScrollArea::_q_kineticScrolling( int dx, int dy )
 void
 AbstractScrollArea::_q_kineticScrollingAboutToStart()
 {
+	d->kineticScrolling = true;
+	d->setInteracting( true );
+
 	d->stopScrollIndicatorsAnimation();
 	d->stopAnimatingBlurEffect();
 }
@@ -1060,10 +1645,15 @@ AbstractScrollArea::_q_kineticScrollingAboutToStart()
 void
 AbstractScrollArea::_q_kineticScrollingFinished()
 {
-	if( d->horIndicator->needPaint || d->vertIndicator->needPaint )
+	d->kineticScrolling = false;
+
+	if( !d->leftMouseButtonPressed )
+		d->setInteracting( false );
+
+	if( d->indicatorsNeedPaint() )
 	{
-		if( d->horIndicator->policy == ScrollIndicatorAsNeeded ||
-			d->vertIndicator->policy == ScrollIndicatorAsNeeded )
+		if( d->horIndicatorPolicy == ScrollIndicatorAsNeeded ||
+			d->vertIndicatorPolicy == ScrollIndicatorAsNeeded )
 				d->animateScrollIndicators();
 	}
 
@@ -1102,4 +1692,11 @@ AbstractScrollArea::_q_startBlurAnim()
 	d->animateHiddingBlurEffect();
 }
 
+void
+AbstractScrollArea::_q_wheelInteractionFinished()
+{
+	if( !d->leftMouseButtonPressed && !d->kineticScrolling )
+		d->setInteracting( false );
+}
+
 } /* namespace QtMWidgets */
@@ -11,6 +11,12 @@
 #include <QFrame>
 #include <QScopedPointer>
 
+// C++ include.
+#include <functional>
+
+// QtMWidgets include.
+#include "memoryusage.hpp"
+
 
 namespace QtMWidgets {
 
@@ -105,6 +111,30 @@ class AbstractScrollArea
 		By default, this property is BlurAlwaysOff.
 	*/
 	Q_PROPERTY( BlurPolicy blurPolicy READ blurPolicy WRITE setBlurPolicy )
+	/*!
+		\property interacting
+
+		\brief Is content of the area moving now.
+
+		Content is moving while the user drags it, while kinetic
+		scrolling is in progress and shortly after wheel events.
+	*/
+	Q_PROPERTY( bool interacting READ isInteracting NOTIFY interactingChanged )
+	/*!
+		\property scrubberEnabled
+
+		\brief Is scrubber shown at the right edge of the viewport.
+
+		Scrubber is shown when the scrolled area is higher than the
+		viewport. Touch position on the scrubber is mapped to the
+		position in the scrolled area, and the area jumps there without
+		scrolling through the intermediate content. Label returned by
+		scrubberLabel() is shown while the scrubber is dragged.
+
+		By default, this property is false.
+	*/
+	Q_PROPERTY( bool scrubberEnabled READ isScrubberEnabled
+		WRITE setScrubberEnabled )
 
 public:
 	/*!
@@ -142,6 +172,13 @@ public:
 	Q_ENUM( ScrollIndicatorPolicy )
 	Q_ENUM( BlurPolicy )
 
+	/*!
+		Function that returns label shown while scrubbing for the
+		given top-left corner of the shown scrolled area.
+	*/
+	typedef std::function< QString ( const QPoint & topLeft ) >
+		ScrubberLabelFunction;
+
 public:
 	AbstractScrollArea( QWidget * parent = 0 );
 	virtual ~AbstractScrollArea();
@@ -188,9 +225,38 @@ public:
 	//! Set blur policy.
 	void setBlurPolicy( BlurPolicy policy );
 
+	/*!
+		\return Is content of the area moving now.
+
+		Subclasses may check it while painting and draw cheaper
+		versions of the content, e.g. scaled down images or
+		cached placeholders. When interaction finishes the viewport
+		is repainted once, so the content will be painted in full
+		quality.
+	*/
+	bool isInteracting() const;
+
+	//! \return Is scrubber enabled.
+	bool isScrubberEnabled() const;
+	//! Enable or disable scrubber.
+	void setScrubberEnabled( bool on );
+
+	//! Set function that returns label shown while scrubbing.
+	void setScrubberLabelFunction( const ScrubberLabelFunction & f );
+
+	/*!
+		\return Approximate memory owned by the area itself, without
+		child widgets.
+	*/
+	virtual MemoryUsage memoryUsage() const;
+
 	QSize minimumSizeHint() const override;
 	QSize sizeHint() const override;
 
+signals:
+	//! Emitted when interaction with the content starts or finishes.
+	void interactingChanged( bool on );
+
 protected:
 	explicit AbstractScrollArea( AbstractScrollAreaPrivate * dd,
 		QWidget * parent = 0 );
@@ -223,6 +289,23 @@ protected:
 	//! Start animation of fading scroll indicators.
 	void startScrollIndicatorsAnimation();
 
+	/*!
+		Show the scrolled area starting from \a topLeft point. Called
+		by the scrubber, that doesn't scroll through intermediate
+		content. Default implementation calls setTopLeftPointShownArea(),
+		subclasses may reimplement it to jump to the position directly.
+	*/
+	virtual void jumpToPosition( const QPoint & topLeft );
+
+	/*!
+		\return Label shown while scrubbing for the given \a topLeft
+		corner of the shown scrolled area. Empty label is not shown.
+
+		Default implementation calls function set with
+		setScrubberLabelFunction().
+	*/
+	virtual QString scrubberLabel( const QPoint & topLeft ) const;
+
 	void resizeEvent( QResizeEvent * e ) override;
 	void mousePressEvent( QMouseEvent * e ) override;
 	void mouseReleaseEvent( QMouseEvent * e ) override;
@@ -244,6 +327,7 @@ private slots:
 	void _q_vertBlurAnim( const QVariant & value );
 	void _q_vertBlurAnimFinished();
 	void _q_startBlurAnim();
+	void _q_wheelInteractionFinished();
 
 private:
 	Q_DISABLE_COPY( AbstractScrollArea )
@@ -6,11 +6,13 @@
 
 // QtMWidgets include.
 #include "busyindicator.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QPainter>
 #include <QVariantAnimation>
 #include <QPainterPath>
+#include <QElapsedTimer>
 
 
 namespace QtMWidgets {
@@ -40,6 +42,7 @@ public:
 	bool running;
 	QVariantAnimation * animation;
 	QColor color;
+	QElapsedTimer frameTimer;
 }; // class BusyIndicatorPrivate
 
 void
@@ -153,9 +156,31 @@ void
 BusyIndicator::paintEvent( QPaintEvent * )
 {
 	QPainter p( this );
-	p.setRenderHint( QPainter::Antialiasing );
+	p.setRenderHint( QPainter::Antialiasing, RenderingQuality::antialiasing() );
 	p.translate( width() / 2, height() / 2 );
 
+	const qreal angle = d->animation->currentValue().toReal();
+
+	if( !RenderingQuality::gradients() )
+	{
+		// Flat ring with the solid head instead of conical gradient.
+		const int penWidth = d->outerRadius - d->innerRadius;
+		const int r = d->innerRadius + penWidth / 2;
+		const QRect ring( -r, -r, r * 2, r * 2 );
+
+		QColor tail = d->color;
+		tail.setAlpha( 60 );
+
+		p.setBrush( Qt::NoBrush );
+		p.setPen( QPen( tail, penWidth, Qt::SolidLine, Qt::FlatCap ) );
+		p.drawEllipse( ring );
+
+		p.setPen( QPen( d->color, penWidth, Qt::SolidLine, Qt::FlatCap ) );
+		p.drawArc( ring, qRound( - angle * 16 ), 90 * 16 );
+
+		return;
+	}
+
 	QPainterPath path;
 	path.setFillRule( Qt::OddEvenFill );
 	path.addEllipse( - d->outerRadius, - d->outerRadius,
@@ -165,7 +190,7 @@ BusyIndicator::paintEvent( QPaintEvent * )
 
 	p.setPen( Qt::NoPen );
 
-	QConicalGradient gradient( 0, 0, - d->animation->currentValue().toReal() );
+	QConicalGradient gradient( 0, 0, - angle );
 	gradient.setColorAt( 0.0, Qt::transparent );
 	gradient.setColorAt( 0.05, d->color );
 	gradient.setColorAt( 1.0, Qt::transparent );
@@ -178,7 +203,8 @@ BusyIndicator::paintEvent( QPaintEvent * )
 void
 BusyIndicator::_q_update( const QVariant & )
 {
-	update();
+	if( RenderingQuality::isFrameDue( d->frameTimer ) )
+		update();
 }
 
 } /* namespace QtMWidgets */
@@ -0,0 +1,277 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "cacheregistry.hpp"
+
+// Qt include.
+#include <QCoreApplication>
+#include <QPointer>
+#include <QByteArray>
+
+
+namespace QtMWidgets {
+
+//
+// AbstractCache
+//
+
+AbstractCache::AbstractCache( const QString & name, int weight )
+	:	m_name( name )
+	,	m_weight( qMax( 1, weight ) )
+{
+	CacheRegistry::registerCache( this );
+}
+
+AbstractCache::~AbstractCache()
+{
+	CacheRegistry::unregisterCache( this );
+}
+
+const QString &
+AbstractCache::name() const
+{
+	return m_name;
+}
+
+int
+AbstractCache::weight() const
+{
+	return m_weight;
+}
+
+void
+AbstractCache::setWeight( int w )
+{
+	if( w < 1 )
+	{
+		qWarning( "AbstractCache::setWeight: weight should be positive." );
+
+		return;
+	}
+
+	m_weight = w;
+}
+
+
+//
+// CacheStatistics
+//
+
+CacheStatistics::CacheStatistics()
+	:	weight( 1 )
+	,	usedBytes( 0 )
+	,	count( 0 )
+	,	hits( 0 )
+	,	misses( 0 )
+{
+}
+
+qreal
+CacheStatistics::hitRate() const
+{
+	const qint64 accesses = hits + misses;
+
+	return ( accesses > 0 ? (qreal) hits / (qreal) accesses : 0.0 );
+}
+
+
+//
+// RegistryData
+//
+
+static const qint64 c_defaultMaxBytes = 16 * 1024 * 1024;
+
+static qint64
+maxBytesFromEnvironment()
+{
+	bool ok = false;
+
+	const qint64 kb = qgetenv( "QTMWIDGETS_CACHE_BUDGET" ).trimmed().toLongLong( &ok );
+
+	return ( ok && kb >= 0 ? kb * 1024 : c_defaultMaxBytes );
+}
+
+struct RegistryData {
+	RegistryData()
+		:	maxBytes( maxBytesFromEnvironment() )
+		,	tick( 0 )
+	{
+	}
+
+	QList< AbstractCache* > caches;
+	qint64 maxBytes;
+	quint64 tick;
+}; // struct RegistryData
+
+// Function-local static is destroyed after the caches registered in it.
+static RegistryData &
+registryData()
+{
+	static RegistryData data;
+
+	return data;
+}
+
+/*
+	Evict least recently used items until \a limit bytes are used.
+	Age of the item is divided by the weight of its cache.
+*/
+static void
+evictUntil( qint64 limit )
+{
+	RegistryData & data = registryData();
+
+	while( CacheRegistry::usedBytes() > limit )
+	{
+		AbstractCache * victim = 0;
+		qreal victimAge = -1.0;
+
+		foreach( AbstractCache * cache, data.caches )
+		{
+			if( cache->count() == 0 )
+				continue;
+
+			const qreal age = (qreal) ( data.tick - cache->oldestAccess() ) /
+				(qreal) cache->weight();
+
+			if( age > victimAge )
+			{
+				victim = cache;
+				victimAge = age;
+			}
+		}
+
+		if( !victim )
+			break;
+
+		victim->evictOldest();
+	}
+}
+
+static QPointer< CacheRegistry > s_instance;
+
+
+//
+// CacheRegistry
+//
+
+CacheRegistry::CacheRegistry( QObject * parent )
+	:	QObject( parent )
+{
+}
+
+CacheRegistry *
+CacheRegistry::instance()
+{
+	if( !s_instance )
+		s_instance = new CacheRegistry( QCoreApplication::instance() );
+
+	return s_instance.data();
+}
+
+qint64
+CacheRegistry::maxBytes()
+{
+	return registryData().maxBytes;
+}
+
+void
+CacheRegistry::setMaxBytes( qint64 bytes )
+{
+	registryData().maxBytes = qMax( Q_INT64_C( 0 ), bytes );
+
+	evictUntil( registryData().maxBytes );
+}
+
+qint64
+CacheRegistry::usedBytes()
+{
+	qint64 bytes = 0;
+
+	foreach( AbstractCache * cache, registryData().caches )
+		bytes += cache->usedBytes();
+
+	return bytes;
+}
+
+QList< CacheStatistics >
+CacheRegistry::statistics()
+{
+	QList< CacheStatistics > result;
+
+	foreach( AbstractCache * cache, registryData().caches )
+	{
+		CacheStatistics s;
+		s.name = cache->name();
+		s.weight = cache->weight();
+		s.usedBytes = cache->usedBytes();
+		s.count = cache->count();
+		s.hits = cache->hits();
+		s.misses = cache->misses();
+
+		result.append( s );
+	}
+
+	return result;
+}
+
+quint64
+CacheRegistry::tick()
+{
+	return ++registryData().tick;
+}
+
+bool
+CacheRegistry::makeRoom( qint64 bytes )
+{
+	const qint64 max = registryData().maxBytes;
+
+	if( bytes > max )
+		return false;
+
+	evictUntil( max - bytes );
+
+	return true;
+}
+
+void
+CacheRegistry::registerCache( AbstractCache * cache )
+{
+	RegistryData & data = registryData();
+
+	if( !data.caches.contains( cache ) )
+		data.caches.append( cache );
+}
+
+void
+CacheRegistry::unregisterCache( AbstractCache * cache )
+{
+	registryData().caches.removeAll( cache );
+}
+
+void
+CacheRegistry::trim( QtMWidgets::CacheRegistry::TrimLevel level )
+{
+	switch( level )
+	{
+		case TrimModerate :
+			evictUntil( registryData().maxBytes / 2 );
+			break;
+
+		case TrimComplete :
+		{
+			foreach( AbstractCache * cache, registryData().caches )
+				cache->clear();
+		}
+			break;
+
+		default :
+			break;
+	}
+}
+
+} /* namespace QtMWidgets */
@@ -0,0 +1,170 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__CACHEREGISTRY_HPP__INCLUDED
+#define QTMWIDGETS__CACHEREGISTRY_HPP__INCLUDED
+
+// Qt include.
+#include <QObject>
+#include <QString>
+#include <QList>
+
+
+namespace QtMWidgets {
+
+//
+// AbstractCache
+//
+
+/*!
+	Base class of the caches managed by CacheRegistry.
+
+	Cache registers itself in the registry on construction and
+	unregisters on destruction. Every access to the cached item
+	should be stamped with CacheRegistry::tick(), so registry
+	can find least recently used items across all caches.
+
+	Weight of the cache tells how valuable its items are: items
+	of the cache with the weight 2 live twice longer without access
+	than items of the cache with the weight 1.
+*/
+class AbstractCache {
+public:
+	AbstractCache( const QString & name, int weight = 1 );
+	virtual ~AbstractCache();
+
+	//! \return Name of the cache.
+	const QString & name() const;
+
+	//! \return Weight of the cache.
+	int weight() const;
+	//! Set weight of the cache. Weight should be positive.
+	void setWeight( int w );
+
+	//! \return Estimated bytes used by cached items.
+	virtual qint64 usedBytes() const = 0;
+	//! \return Count of cached items.
+	virtual int count() const = 0;
+	//! \return Count of cache hits.
+	virtual qint64 hits() const = 0;
+	//! \return Count of cache misses.
+	virtual qint64 misses() const = 0;
+
+	//! \return Access stamp of the least recently used item, 0 if empty.
+	virtual quint64 oldestAccess() const = 0;
+	//! Remove least recently used item.
+	virtual void evictOldest() = 0;
+	//! Remove all items.
+	virtual void clear() = 0;
+
+private:
+	Q_DISABLE_COPY( AbstractCache )
+
+	QString m_name;
+	int m_weight;
+}; // class AbstractCache
+
+
+//
+// CacheStatistics
+//
+
+//! Occupancy and efficiency of the one cache.
+class CacheStatistics {
+public:
+	CacheStatistics();
+
+	//! \return Ratio of hits to all accesses, 0 if cache wasn't used.
+	qreal hitRate() const;
+
+	QString name;
+	int weight;
+	qint64 usedBytes;
+	int count;
+	qint64 hits;
+	qint64 misses;
+}; // class CacheStatistics
+
+
+//
+// CacheRegistry
+//
+
+/*!
+	CacheRegistry holds global byte budget of all the caches in
+	QtMWidgets (text layouts, row pixmaps, sprites and so on).
+
+	Before inserting new item cache asks registry for the room,
+	and registry evicts least recently used items across all
+	registered caches, taking weights of the caches into account,
+	until the new item fits the budget.
+
+	Initial budget may be set with QTMWIDGETS_CACHE_BUDGET
+	environment variable in kilobytes, default is 16 MB. Connect
+	memory-pressure notifications of the platform to trim().
+
+	Should be used from the GUI thread only.
+*/
+class CacheRegistry
+	:	public QObject
+{
+	Q_OBJECT
+
+public:
+	//! How much memory should be released by trim().
+	enum TrimLevel {
+		//! Release least recently used items down to half of the budget.
+		TrimModerate = 0,
+		//! Release all cached items.
+		TrimComplete = 1
+	}; // enum TrimLevel
+
+	Q_ENUM( TrimLevel )
+
+public:
+	//! \return Instance, use it to connect to trim().
+	static CacheRegistry * instance();
+
+	//! \return Global byte budget.
+	static qint64 maxBytes();
+	//! Set global byte budget, evicts items if needed.
+	static void setMaxBytes( qint64 bytes );
+
+	//! \return Estimated bytes used by all registered caches.
+	static qint64 usedBytes();
+
+	//! \return Statistics of all registered caches.
+	static QList< CacheStatistics > statistics();
+
+	//! \return Next access stamp, stamps grow monotonically.
+	static quint64 tick();
+
+	/*!
+		Evict items until \a bytes more bytes fit the budget.
+
+		\return false if \a bytes is larger than the whole budget,
+		nothing is evicted then and item shouldn't be cached.
+	*/
+	static bool makeRoom( qint64 bytes );
+
+	//! Register cache. Called by AbstractCache.
+	static void registerCache( AbstractCache * cache );
+	//! Unregister cache. Called by AbstractCache.
+	static void unregisterCache( AbstractCache * cache );
+
+public slots:
+	//! Release cached items, should be called on memory pressure.
+	void trim( QtMWidgets::CacheRegistry::TrimLevel level );
+
+private:
+	explicit CacheRegistry( QObject * parent );
+
+	Q_DISABLE_COPY( CacheRegistry )
+}; // class CacheRegistry
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__CACHEREGISTRY_HPP__INCLUDED
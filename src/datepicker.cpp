@@ -25,6 +25,12 @@ DatePicker::DatePicker( const QDate & date, QWidget * parent )
 {
 }
 
+DatePicker::DatePicker( const DateTimeFormat & format, QWidget * parent )
+	:	DateTimePicker( DATETIMEPICKER_DATE_INITIAL, QMetaType::QDate,
+			format, parent )
+{
+}
+
 DatePicker::~DatePicker()
 {
 }
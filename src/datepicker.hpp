@@ -38,6 +38,13 @@ class DatePicker
 public:
 	explicit DatePicker( QWidget * parent = 0 );
 	explicit DatePicker( const QDate & date, QWidget * parent = 0 );
+	/*!
+		Construct picker with sections from the compile-time \a format
+		descriptor, time sections of the format are skipped.
+
+		\sa DateTimeFormat
+	*/
+	explicit DatePicker( const DateTimeFormat & format, QWidget * parent = 0 );
 
 	virtual ~DatePicker();
 }; // class DatePicker
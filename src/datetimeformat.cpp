@@ -0,0 +1,29 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "datetimeformat.hpp"
+
+// Qt include.
+#include <QtGlobal>
+
+
+namespace QtMWidgets {
+
+//
+// DateTimeFormat
+//
+
+void
+DateTimeFormat::invalidFormat( const char * reason )
+{
+	qWarning( "DateTimeFormat: %s", reason );
+
+	m_valid = false;
+	m_count = 0;
+}
+
+} /* namespace QtMWidgets */
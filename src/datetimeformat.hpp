@@ -0,0 +1,226 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__DATETIMEFORMAT_HPP__INCLUDED
+#define QTMWIDGETS__DATETIMEFORMAT_HPP__INCLUDED
+
+// C++ include.
+#include <cstddef>
+
+
+namespace QtMWidgets {
+
+//
+// DateTimeFormat
+//
+
+/*!
+	DateTimeFormat is a compile-time descriptor of the date & time
+	format used by DateTimePicker.
+
+	The format string is interpreted by the constexpr constructor,
+	so the table of sections is ready before the picker is created
+	and the picker doesn't parse anything.
+
+	\code
+	static constexpr QtMWidgets::DateTimeFormat dateFormat( "dd.MM.yyyy" );
+
+	QtMWidgets::DateTimePicker picker( dateFormat );
+	\endcode
+
+	The grammar is the same as in DateTimePicker::setFormat().
+	When the descriptor is declared constexpr wrong format string
+	is a compile error. Descriptor constructed at runtime from wrong
+	format string is not valid and will be ignored by the picker.
+*/
+class DateTimeFormat {
+public:
+	//! Field of the format, the values match the sections of the picker.
+	enum Field {
+		NoField = 0x00000,
+		AmPm = 0x00001,
+		Second = 0x00002,
+		Minute = 0x00004,
+		Hour12 = 0x00008,
+		Hour24 = 0x00010,
+		Day = 0x00020,
+		DayShort = 0x00040,
+		DayLong = 0x00080,
+		Month = 0x00100,
+		MonthShort = 0x00200,
+		MonthLong = 0x00400,
+		Year = 0x00800,
+		Year2Digits = 0x01000
+	}; // enum Field
+
+	//! Max count of the fields in the format.
+	static constexpr int MaxFields = 7;
+
+	template< std::size_t N >
+	constexpr DateTimeFormat( const char ( &fmt )[ N ] )
+		:	m_format( fmt )
+		,	m_count( 0 )
+		,	m_valid( true )
+		,	m_fields{}
+		,	m_zeroes{}
+	{
+		int amPm = -1;
+		int second = -1;
+		int minute = -1;
+		int hour = -1;
+		int day = -1;
+		int month = -1;
+		int year = -1;
+
+		for( std::size_t i = 0; i < N && fmt[ i ] != '\0'; ++i )
+		{
+			const std::size_t count = countRepeat( fmt, N, i,
+				( fmt[ i ] == 'y' || fmt[ i ] == 'M' || fmt[ i ] == 'd' ) ? 4 : 2 );
+
+			switch( fmt[ i ] )
+			{
+				case 'h' :
+					add( hour, ( amPm != -1 ? Hour12 : Hour24 ), count == 2 );
+					break;
+
+				case 'm' :
+					add( minute, Minute, count == 2 );
+					break;
+
+				case 's' :
+					add( second, Second, count == 2 );
+					break;
+
+				case 'a' :
+				{
+					if( hour != -1 )
+						m_fields[ hour ] = Hour12;
+
+					add( amPm, AmPm, false );
+				} break;
+
+				case 'y' :
+				{
+					if( count == 2 )
+						add( year, Year2Digits, false );
+					else if( count == 4 )
+						add( year, Year, false );
+					else
+						invalidFormat( "wrong value of the years section." );
+				} break;
+
+				case 'M' :
+					add( month, ( count == 3 ? MonthShort :
+						count == 4 ? MonthLong : Month ), count == 2 );
+					break;
+
+				case 'd' :
+					add( day, ( count == 3 ? DayShort :
+						count == 4 ? DayLong : Day ), count == 2 );
+					break;
+
+				default :
+				{
+					if( !isSeparator( fmt[ i ] ) )
+						invalidFormat( "prohibited character in the format string." );
+				} break;
+			}
+
+			if( !m_valid )
+				return;
+
+			if( fmt[ i ] != 'a' && !isSeparator( fmt[ i ] ) )
+				i += ( count - 1 );
+		}
+	}
+
+	//! \return Is format valid.
+	constexpr bool isValid() const
+	{
+		return m_valid;
+	}
+
+	//! \return Format string.
+	constexpr const char * format() const
+	{
+		return m_format;
+	}
+
+	//! \return Count of the fields.
+	constexpr int count() const
+	{
+		return m_count;
+	}
+
+	//! \return Field with the given \a index.
+	constexpr Field field( int index ) const
+	{
+		return m_fields[ index ];
+	}
+
+	//! \return Is field with the given \a index prepended with zeroes?
+	constexpr bool zeroesAdded( int index ) const
+	{
+		return m_zeroes[ index ];
+	}
+
+	//! \return Is \a ch separator between fields.
+	static constexpr bool isSeparator( char ch )
+	{
+		return ( ch == ' ' || ch == '.' || ch == ':' || ch == '-' ||
+			ch == '/' || ch == ',' );
+	}
+
+private:
+	static constexpr std::size_t countRepeat( const char * fmt, std::size_t size,
+		std::size_t index, std::size_t maxCount )
+	{
+		std::size_t count = 1;
+
+		while( count < maxCount && index + count < size &&
+			fmt[ index + count ] == fmt[ index ] )
+				++count;
+
+		return count;
+	}
+
+	constexpr void add( int & index, Field f, bool zeroes )
+	{
+		if( index != -1 )
+		{
+			invalidFormat( "redefinition of the section." );
+
+			return;
+		}
+
+		index = m_count;
+		m_fields[ m_count ] = f;
+		m_zeroes[ m_count ] = zeroes;
+		++m_count;
+	}
+
+	/*
+		Not constexpr, so constant evaluation of the wrong format
+		fails to compile here.
+	*/
+	void invalidFormat( const char * reason );
+
+private:
+	//! Format string.
+	const char * m_format;
+	//! Count of the fields.
+	int m_count;
+	//! Is format valid.
+	bool m_valid;
+	//! Fields.
+	Field m_fields[ MaxFields ];
+	//! Are fields prepended with zeroes?
+	bool m_zeroes[ MaxFields ];
+}; // class DateTimeFormat
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__DATETIMEFORMAT_HPP__INCLUDED
@@ -7,8 +7,8 @@
 // QtMWidgets include.
 #include "datetimepicker.hpp"
 #include "private/datetimeparser.hpp"
+#include "private/pickersections.hpp"
 #include "private/drawing.hpp"
-#include "color.hpp"
 #include "scroller.hpp"
 
 // Qt include.
@@ -18,7 +18,8 @@
 #include <QStyleOption>
 #include <QBrush>
 #include <QPen>
-#include <QLinearGradient>
+#include <QTimer>
+#include <QVariantAnimation>
 
 
 namespace QtMWidgets {
@@ -29,85 +30,122 @@ namespace QtMWidgets {
 
 class DateTimePickerPrivate
 	:	public DateTimeParser
+	,	public PickerSections
 {
 public:
 	DateTimePickerPrivate( DateTimePicker * parent,
-		QMetaType::Type parserType )
-		:	DateTimeParser( parserType )
+		QMetaType::Type parserType,
+		const DateTimeFormat & fmt = DateTimeParser::defaultFormat )
+		:	DateTimeParser( parserType, fmt )
+		,	PickerSections( parent, DateTimeParser::sections )
 		,	q( parent )
-		,	minimum( QDateTime( DATETIMEPICKER_COMPAT_DATE_MIN,
-				DATETIMEPICKER_TIME_MIN ) )
-		,	maximum( DATETIMEPICKER_DATETIME_MAX )
-		,	value( QDateTime( DATETIMEPICKER_DATE_INITIAL,
-				DATETIMEPICKER_TIME_MIN ) )
+		,	minimum( DATETIMEPICKER_COMPAT_FIELDS_MIN )
+		,	maximum( DATETIMEPICKER_FIELDS_MAX )
+		,	value( DATETIMEPICKER_FIELDS_INITIAL )
+		,	emitted( value )
 		,	spec( Qt::LocalTime )
-		,	itemHeight( 0 )
-		,	itemTopMargin( 0 )
-		,	itemsMaxCount( 5 )
-		,	itemSideMargin( 5 )
-		,	widgetHeight( 0 )
-		,	currentItemY( 0 )
 		,	leftMouseButtonPressed( false )
-		,	movableSection( -1 )
 		,	daysSection( -1 )
 		,	monthSection( -1 )
 		,	yearSection( -1 )
 		,	scroller( new Scroller( q, q ) )
 		,	scrolling( false )
+		,	liveValid( false )
+		,	livePending( false )
+		,	signalPolicy( DateTimePicker::EmitOnSettle )
+		,	throttleRate( 10 )
+		,	throttleTimer( 0 )
 	{
 		initDaysMonthYearSectionIndex();
 		fillValues();
 	}
 
-	void updateTimeSpec();
-	void setRange( const QDateTime & min, const QDateTime & max );
-	void setValue( const QDateTime & dt, bool updateIndexes = true );
-	void emitSignals();
-	void normalizeOffset( int section );
-	void normalizeOffsets();
-	void drawSectionItems( int section, QPainter * p,
-		const QStyleOption & opt );
-	void drawWindow( QPainter * p, const QStyleOption & opt );
-	void findMovableSection( const QPointF & pos );
-	void updateOffset( int delta );
-	void clearOffset();
+	void init();
+
+	void updateTimeSpec( Qt::TimeSpec oldSpec );
+	void setRange( const DateTimeFields & min, const DateTimeFields & max );
+	void setMinimum( const DateTimeFields & min );
+	void setMaximum( const DateTimeFields & max );
+	void setValue( const DateTimeFields & dt, bool updateIndexes = true );
+	void emitSignals( const DateTimeFields & dt );
+	DateTimeFields fieldsFromSections() const;
+	DateTimeFields toFields( const QDateTime & dt ) const;
+	QDateTime toDateTime( const DateTimeFields & f ) const;
+	void scrollStep();
+	void emitLive();
+	void stopLive();
 	void updateDaysIfNeeded();
 	void updateCurrentDateTime();
 	void initDaysMonthYearSectionIndex();
 	void fillValues( bool updateIndexes = true );
 	void releaseScrolling();
 
+	using DateTimeParser::sections;
+
 	DateTimePicker * q;
-	QDateTime minimum;
-	QDateTime maximum;
-	QDateTime value;
+	DateTimeFields minimum;
+	DateTimeFields maximum;
+	DateTimeFields value;
+	//! Last value passed to the signals.
+	DateTimeFields emitted;
 	Qt::TimeSpec spec;
-	int itemHeight;
-	int itemTopMargin;
-	int itemsMaxCount; // Must be odd.
-	int itemSideMargin;
-	int widgetHeight;
-	int currentItemY;
 	QPoint mousePos;
 	bool leftMouseButtonPressed;
-	int movableSection;
 	int daysSection;
 	int monthSection;
 	int yearSection;
 	Scroller * scroller;
 	bool scrolling;
+	//! Value shown while scrolling.
+	DateTimeFields liveFields;
+	bool liveValid;
+	bool livePending;
+	DateTimePicker::SignalPolicy signalPolicy;
+	int throttleRate;
+	QTimer * throttleTimer;
 }; // class DateTimePickerPrivate
 
 void
-DateTimePickerPrivate::updateTimeSpec()
+DateTimePickerPrivate::init()
 {
-	minimum = minimum.toTimeSpec( spec );
-	maximum = maximum.toTimeSpec( spec );
-	value = value.toTimeSpec( spec );
+	q->setSizePolicy( QSizePolicy( QSizePolicy::Fixed,
+		QSizePolicy::Fixed ) );
+
+	throttleTimer = new QTimer( q );
+	throttleTimer->setSingleShot( true );
+
+	QObject::connect( scroller, &Scroller::aboutToStart,
+		q, &DateTimePicker::_q_scrollAboutToStart );
+
+	QObject::connect( scroller, &Scroller::scroll,
+		q, &DateTimePicker::_q_scroll );
+
+	QObject::connect( scroller, &Scroller::finished,
+		q, &DateTimePicker::_q_scrollFinished );
+
+	QObject::connect( throttleTimer, &QTimer::timeout,
+		q, &DateTimePicker::_q_emitThrottled );
 }
 
 void
-DateTimePickerPrivate::setRange( const QDateTime & min, const QDateTime & max )
+DateTimePickerPrivate::updateTimeSpec( Qt::TimeSpec oldSpec )
+{
+	minimum = DateTimeFields::fromDateTime(
+		minimum.toDateTime( oldSpec ).toTimeSpec( spec ) );
+	maximum = DateTimeFields::fromDateTime(
+		maximum.toDateTime( oldSpec ).toTimeSpec( spec ) );
+	value = DateTimeFields::fromDateTime(
+		value.toDateTime( oldSpec ).toTimeSpec( spec ) );
+	emitted = value;
+
+	fillValues();
+
+	q->update();
+}
+
+void
+DateTimePickerPrivate::setRange( const DateTimeFields & min,
+	const DateTimeFields & max )
 {
 	if( minimum != min || maximum != max )
 	{
@@ -116,9 +154,12 @@ DateTimePickerPrivate::setRange( const QDateTime & min, const QDateTime & max )
 
 		if( value < minimum )
 			value = minimum;
-		else if( value > maximum )
+		else if( maximum < value )
 			value = maximum;
 
+		// Changing of the range doesn't notify about the value.
+		emitted = value;
+
 		fillValues();
 
 		q->updateGeometry();
@@ -127,16 +168,28 @@ DateTimePickerPrivate::setRange( const QDateTime & min, const QDateTime & max )
 }
 
 void
-DateTimePickerPrivate::setValue( const QDateTime & dt, bool updateIndexes )
+DateTimePickerPrivate::setMinimum( const DateTimeFields & min )
+{
+	setRange( min, ( min < maximum ? maximum : min ) );
+}
+
+void
+DateTimePickerPrivate::setMaximum( const DateTimeFields & max )
+{
+	setRange( ( minimum < max ? minimum : max ), max );
+}
+
+void
+DateTimePickerPrivate::setValue( const DateTimeFields & dt, bool updateIndexes )
 {
 	if( value != dt )
 	{
-		if( dt >= minimum && dt <= maximum )
-			value = dt;
-		else if( dt < minimum )
+		if( dt < minimum )
 			value = minimum;
-		else if( dt > maximum )
+		else if( maximum < dt )
 			value = maximum;
+		else
+			value = dt;
 
 		fillValues( updateIndexes );
 
@@ -148,8 +201,8 @@ DateTimePickerPrivate::setValue( const QDateTime & dt, bool updateIndexes )
 				{
 					case Section::AmPmSection :
 					{
-						if( value.time().hour() == 0 ||
-							value.time().hour() > 12 )
+						if( value.hour == 0 ||
+							value.hour > 12 )
 								sections[ i ].currentIndex = 1;
 						else
 							sections[ i ].currentIndex = 0;
@@ -158,30 +211,30 @@ DateTimePickerPrivate::setValue( const QDateTime & dt, bool updateIndexes )
 
 					case Section::SecondSection :
 					{
-						sections[ i ].currentIndex = value.time().second();
+						sections[ i ].currentIndex = value.second;
 					}
 					break;
 
 					case Section::MinuteSection :
 					{
-						sections[ i ].currentIndex = value.time().minute();
+						sections[ i ].currentIndex = value.minute;
 					}
 					break;
 
 					case Section::Hour12Section :
 					{
-						if( value.time().hour() == 0 )
+						if( value.hour == 0 )
 							sections[ i ].currentIndex = 11;
-						else if( value.time().hour() > 12 )
-							sections[ i ].currentIndex = value.time().hour() - 12 - 1;
+						else if( value.hour > 12 )
+							sections[ i ].currentIndex = value.hour - 12 - 1;
 						else
-							sections[ i ].currentIndex = value.time().hour() - 1;
+							sections[ i ].currentIndex = value.hour - 1;
 					}
 					break;
 
 					case Section::Hour24Section :
 					{
-						sections[ i ].currentIndex = value.time().hour();
+						sections[ i ].currentIndex = value.hour;
 					}
 					break;
 
@@ -189,7 +242,7 @@ DateTimePickerPrivate::setValue( const QDateTime & dt, bool updateIndexes )
 					case Section::DaySectionShort :
 					case Section::DaySectionLong :
 					{
-						sections[ i ].currentIndex = value.date().day() - 1;
+						sections[ i ].currentIndex = value.day - 1;
 					}
 					break;
 
@@ -197,15 +250,14 @@ DateTimePickerPrivate::setValue( const QDateTime & dt, bool updateIndexes )
 					case Section::MonthSectionShort :
 					case Section::MonthSectionLong :
 					{
-						sections[ i ].currentIndex = value.date().month() - 1;
+						sections[ i ].currentIndex = value.month - 1;
 					}
 					break;
 
 					case Section::YearSection :
 					case Section::YearSection2Digits :
 					{
-						sections[ i ].currentIndex = value.date().year() -
-							minimum.date().year();
+						sections[ i ].currentIndex = value.year - minimum.year;
 					}
 					break;
 
@@ -215,279 +267,46 @@ DateTimePickerPrivate::setValue( const QDateTime & dt, bool updateIndexes )
 			}
 		}
 
-		emitSignals();
-	}
-}
-
-void
-DateTimePickerPrivate::emitSignals()
-{
-	emit q->dateTimeChanged( value );
-	emit q->dateChanged( value.date() );
-	emit q->timeChanged( value.time() );
-}
-
-static inline int prevIndex( int current, int size )
-{
-	if( current == 0 )
-		return size - 1;
-	else
-		return current - 1;
-}
-
-static inline int nextIndex( int current, int size )
-{
-	if( current == size - 1 )
-		return 0;
-	else
-		return current + 1;
-}
-
-void
-DateTimePickerPrivate::normalizeOffset( int section )
-{
-	const int sectionValuesSize = sections.at( section ).values.size();
-	const int totalItemHeight = itemHeight + itemTopMargin;
-
-	while( qAbs( sections.at( section ).offset ) > totalItemHeight / 2 )
-	{
-		if( sections.at( section ).offset > 0 )
-		{
-			if( sectionValuesSize < itemsMaxCount &&
-				sections[ section ].currentIndex == 0 )
-			{
-				sections[ section ].offset = 0;
-				break;
-			}
-
-			sections[ section ].offset -= totalItemHeight;
-			sections[ section ].currentIndex = prevIndex(
-				sections.at( section ).currentIndex, sectionValuesSize );
-		}
-		else
-		{
-			if( sectionValuesSize < itemsMaxCount &&
-				sections[ section ].currentIndex ==
-					sections[ section ].values.size() - 1 )
-			{
-				sections[ section ].offset = 0;
-				break;
-			}
-
-			sections[ section ].offset += totalItemHeight;
-			sections[ section ].currentIndex = nextIndex(
-				sections.at( section ).currentIndex, sectionValuesSize );
-		}
-	}
-}
-
-void
-DateTimePickerPrivate::normalizeOffsets()
-{
-	for( int i = 0; i < sections.size(); ++i )
-		normalizeOffset( i );
-}
-
-void
-DateTimePickerPrivate::drawSectionItems( int section, QPainter * p,
-	const QStyleOption & opt )
-{
-	int x = 0;
-
-	for( int i = 0; i < section; ++i )
-		x += sections.at( i ).sectionWidth;
-
-	x += 3 + itemSideMargin;
-
-	p->setPen( opt.palette.color( QPalette::WindowText ) );
-
-	const int yOffset = sections.at( section ).offset;
-
-	int makePrevIndexCount = itemsMaxCount / 2;
-
-	if( yOffset > 0 )
-		++makePrevIndexCount;
-
-	if( sections.at( section ).values.size() < itemsMaxCount )
-		makePrevIndexCount = sections.at( section ).currentIndex;
-
-	int index = sections.at( section ).currentIndex;
-	int y = currentItemY + yOffset;
-
-	for( int i = 0; i < makePrevIndexCount; ++i )
-	{
-		index = prevIndex( index, sections.at( section ).values.size() );
-		y -= ( itemHeight + itemTopMargin );
-	}
-
-	int iterationsCount = ( yOffset == 0 ) ? itemsMaxCount : itemsMaxCount + 1;
-
-	if( sections.at( section ).values.size() < itemsMaxCount )
-		iterationsCount = sections.at( section ).values.size();
-
-	const int textWidth = sections.at( section ).sectionWidth - 6 -
-		itemSideMargin * 2;
-
-	Section::Type type = sections.at( section ).type;
-
-	for( int i = 0; i < iterationsCount; ++i )
-	{
-		const QRect r( x, y, textWidth, itemHeight );
-
-		const QString text = sections.at( section ).values.at( index );
-
-		if( type == Section::DaySectionShort ||
-			type == Section::DaySectionLong )
-		{
-			QStringList values = text.split( QLatin1Char( ' ' ) );
-
-			p->setPen(
-				lighterColor( opt.palette.color( QPalette::WindowText ), 75 ) );
-			p->drawText( r, Qt::AlignLeft | Qt::TextSingleLine, values.at( 0 ) );
-
-			p->setPen( opt.palette.color( QPalette::WindowText ) );
-			p->drawText( r, Qt::AlignRight | Qt::TextSingleLine, values.at( 1 ) );
-		}
-		else
-			p->drawText( r, Qt::AlignLeft | Qt::TextSingleLine, text );
-
-		index = nextIndex( index, sections.at( section ).values.size() );
-		y += itemHeight + itemTopMargin;
+		// Value could be emitted already while scrolling.
+		if( value != emitted )
+			emitSignals( value );
 	}
+	// Intermediate value was emitted while scrolling.
+	else if( value != emitted )
+		emitSignals( value );
 }
 
 void
-DateTimePickerPrivate::drawWindow( QPainter * p, const QStyleOption & opt )
+DateTimePickerPrivate::emitSignals( const DateTimeFields & dt )
 {
-	const int windowOffset = itemHeight / 4;
-	const int windowHeight = itemHeight + windowOffset * 2;
-	const int windowMiddleHeight = windowHeight / 2;
-
-	const int alpha = 150;
-	const int alpha2 = 255;
-
-	int yTop = currentItemY - windowOffset;
-	int yBottom = yTop + windowMiddleHeight * 2;
-
-	const QColor baseColor = q->palette().color( QPalette::Dark );
-
-	QColor c1 = baseColor;
-	c1.setAlpha( alpha2 );
-	p->setPen( c1 );
-
-	p->drawLine( 0, yTop, opt.rect.width(), yTop );
-	p->drawLine( 0, yBottom, opt.rect.width(), yBottom );
-
-	QColor c2 = lighterColor( baseColor, 110 );
-	c2.setAlpha( alpha2 );
-	p->setPen( c2 );
-
-	p->drawLine( 0, yTop + 1, opt.rect.width(), yTop + 2 );
+	emitted = dt;
 
-	QLinearGradient g( QPointF( 0.0, 0.0 ), QPointF( 0.0, 1.0 ) );
-	g.setCoordinateMode( QGradient::ObjectBoundingMode );
+	const QDateTime dateTime = toDateTime( dt );
 
-	QColor c3 = lighterColor( baseColor, 95 );
-	c3.setAlpha( alpha );
-	g.setColorAt( 0.0, c3 );
-
-	QColor c4 = lighterColor( baseColor, 50 );
-	c4.setAlpha( alpha );
-	g.setColorAt( 1.0, c4 );
-
-	p->setPen( Qt::NoPen );
-	p->setBrush( g );
-
-	p->drawRect( 0, yTop + 2, opt.rect.width(), windowMiddleHeight - 2 );
-
-	QColor c5 = lighterColor( baseColor, 35 );
-	c5.setAlpha( alpha );
-	p->setBrush( c5 );
-	p->drawRect( 0, yTop + windowMiddleHeight,
-		opt.rect.width(), windowMiddleHeight );
+	emit q->dateTimeChanged( dateTime );
+	emit q->dateChanged( dateTime.date() );
+	emit q->timeChanged( dateTime.time() );
 }
 
-void
-DateTimePickerPrivate::findMovableSection( const QPointF & pos )
+DateTimeFields
+DateTimePickerPrivate::toFields( const QDateTime & dt ) const
 {
-	const int x = pos.x();
-
-	int width = 0;
-
-	for( int i = 0; i < sections.size(); ++i )
-	{
-		if( x >= width && x < width + sections.at( i ).sectionWidth )
-		{
-			movableSection = i;
-			return;
-		}
-
-		width += sections.at( i ).sectionWidth;
-	}
-
-	movableSection = -1;
-}
-
-void
-DateTimePickerPrivate::updateOffset( int delta )
-{
-	if( movableSection != -1 )
-		sections[ movableSection ].offset += delta;
+	return DateTimeFields::fromDateTime( dt.toTimeSpec( spec ) );
 }
 
-void
-DateTimePickerPrivate::clearOffset()
+QDateTime
+DateTimePickerPrivate::toDateTime( const DateTimeFields & f ) const
 {
-	if( movableSection != -1 )
-		sections[ movableSection ].offset = 0;
+	return f.toDateTime( spec );
 }
 
-void
-DateTimePickerPrivate::updateDaysIfNeeded()
+DateTimeFields
+DateTimePickerPrivate::fieldsFromSections() const
 {
-	if( movableSection != -1 &&
-		( movableSection == monthSection || movableSection == yearSection ) )
-	{
-		if( daysSection != -1 )
-		{
-			QDateTime dummy = value;
-			QDate date = dummy.date();
-
-			int year = dummy.date().year();
-			int month = dummy.date().month();
-
-			if( monthSection != -1 )
-				month = sections[ monthSection ].currentIndex + 1;
-
-			if( yearSection != -1 )
-				year = minimum.date().year() + sections[ yearSection ].currentIndex;
-
-			date.setDate( year, month, 28 );
-			dummy.setDate( date );
-
-			sections[ daysSection ].fillValues( dummy, minimum, maximum,
-				false );
+	DateTimeFields f = value;
 
-			if( sections[ daysSection ].currentIndex >
-				sections[ daysSection ].values.size() - 1 )
-			{
-				sections[ daysSection ].currentIndex =
-					sections[ daysSection ].values.size() - 1;
-			}
-		}
-	}
-}
-
-void
-DateTimePickerPrivate::updateCurrentDateTime()
-{
-	int year = value.date().year();
-	int month = value.date().month();
 	int day = -1;
-	int hour = value.time().hour();
-	int minute = value.time().minute();
-	int second = value.time().second();
-	int msecs = value.time().msec();
+	int hour = f.hour;
 	int amPm = -1;
 
 	for( int i = 0; i < sections.size(); ++i )
@@ -502,13 +321,13 @@ DateTimePickerPrivate::updateCurrentDateTime()
 
 			case Section::SecondSection :
 			{
-				second = sections.at( i ).currentIndex;
+				f.second = sections.at( i ).currentIndex;
 			}
 			break;
 
 			case Section::MinuteSection :
 			{
-				minute = sections.at( i ).currentIndex;
+				f.minute = sections.at( i ).currentIndex;
 			}
 			break;
 
@@ -531,14 +350,14 @@ DateTimePickerPrivate::updateCurrentDateTime()
 			case Section::MonthSectionShort :
 			case Section::MonthSectionLong :
 			{
-				month = sections.at( i ).currentIndex + 1;
+				f.month = sections.at( i ).currentIndex + 1;
 			}
 			break;
 
 			case Section::YearSection :
 			case Section::YearSection2Digits :
 			{
-				year = minimum.date().year() + sections.at( i ).currentIndex;
+				f.year = minimum.year + sections.at( i ).currentIndex;
 			}
 			break;
 
@@ -565,8 +384,99 @@ DateTimePickerPrivate::updateCurrentDateTime()
 			hour += 12 + 1;
 	}
 
-	setValue( QDateTime( QDate( year, month, day ),
-		QTime( hour, minute, second, msecs ), spec ), false );
+	f.hour = hour;
+	// Days section is refilled only when scrolling is finished.
+	f.day = qMin( day, DateTimeFields::daysInMonth( f.year, f.month ) );
+
+	return f;
+}
+
+void
+DateTimePickerPrivate::scrollStep()
+{
+	if( signalPolicy == DateTimePicker::EmitOnSettle || movableSection == -1 )
+		return;
+
+	normalizeOffset( movableSection );
+
+	DateTimeFields f = fieldsFromSections();
+
+	if( f < minimum )
+		f = minimum;
+	else if( maximum < f )
+		f = maximum;
+
+	if( liveValid && f == liveFields )
+		return;
+
+	liveFields = f;
+	liveValid = true;
+
+	if( signalPolicy == DateTimePicker::EmitLive )
+		emitLive();
+	else if( throttleTimer->isActive() )
+		livePending = true;
+	else
+	{
+		emitLive();
+
+		throttleTimer->start( 1000 / throttleRate );
+	}
+}
+
+void
+DateTimePickerPrivate::emitLive()
+{
+	livePending = false;
+
+	if( liveFields != emitted )
+		emitSignals( liveFields );
+}
+
+void
+DateTimePickerPrivate::stopLive()
+{
+	throttleTimer->stop();
+
+	liveValid = false;
+	livePending = false;
+}
+
+void
+DateTimePickerPrivate::updateDaysIfNeeded()
+{
+	if( movableSection != -1 &&
+		( movableSection == monthSection || movableSection == yearSection ) )
+	{
+		if( daysSection != -1 )
+		{
+			DateTimeFields dummy = value;
+
+			if( monthSection != -1 )
+				dummy.month = sections[ monthSection ].currentIndex + 1;
+
+			if( yearSection != -1 )
+				dummy.year = minimum.year + sections[ yearSection ].currentIndex;
+
+			dummy.day = 28;
+
+			sections[ daysSection ].fillValues( dummy, minimum, maximum,
+				false );
+
+			if( sections[ daysSection ].currentIndex >
+				sections[ daysSection ].values.size() - 1 )
+			{
+				sections[ daysSection ].currentIndex =
+					sections[ daysSection ].values.size() - 1;
+			}
+		}
+	}
+}
+
+void
+DateTimePickerPrivate::updateCurrentDateTime()
+{
+	setValue( fieldsFromSections(), false );
 }
 
 void
@@ -609,6 +519,7 @@ DateTimePickerPrivate::releaseScrolling()
 {
 	leftMouseButtonPressed = false;
 
+	stopLive();
 	clearOffset();
 	updateDaysIfNeeded();
 	updateCurrentDateTime();
@@ -628,83 +539,55 @@ DateTimePicker::DateTimePicker( QWidget * parent )
 	:	QWidget( parent )
 	,	d( new DateTimePickerPrivate( this, QMetaType::QDateTime ) )
 {
-	setSizePolicy( QSizePolicy( QSizePolicy::Fixed,
-		QSizePolicy::Fixed ) );
-
-	connect( d->scroller, &Scroller::aboutToStart,
-		this, &DateTimePicker::_q_scrollAboutToStart );
-
-	connect( d->scroller, &Scroller::scroll,
-		this, &DateTimePicker::_q_scroll );
-
-	connect( d->scroller, &Scroller::finished,
-		this, &DateTimePicker::_q_scrollFinished );
+	d->init();
 }
 
 DateTimePicker::DateTimePicker( const QDateTime & dt, QWidget * parent )
 	:	QWidget( parent )
 	,	d( new DateTimePickerPrivate( this, QMetaType::QDateTime ) )
 {
-	setSizePolicy( QSizePolicy( QSizePolicy::Fixed,
-		QSizePolicy::Fixed ) );
+	d->init();
 
 	setDateTime( dt.isValid() ? dt : DATETIMEPICKER_DATETIME_MIN );
-
-	connect( d->scroller, &Scroller::aboutToStart,
-		this, &DateTimePicker::_q_scrollAboutToStart );
-
-	connect( d->scroller, &Scroller::scroll,
-		this, &DateTimePicker::_q_scroll );
-
-	connect( d->scroller, &Scroller::finished,
-		this, &DateTimePicker::_q_scrollFinished );
 }
 
 DateTimePicker::DateTimePicker( const QDate & date, QWidget * parent )
 	:	QWidget( parent )
 	,	d( new DateTimePickerPrivate( this, QMetaType::QDate ) )
 {
-	setSizePolicy( QSizePolicy( QSizePolicy::Fixed,
-		QSizePolicy::Fixed ) );
+	d->init();
 
 	setDate( date.isValid() ? date : DATETIMEPICKER_DATE_MIN );
-
-	connect( d->scroller, &Scroller::aboutToStart,
-		this, &DateTimePicker::_q_scrollAboutToStart );
-
-	connect( d->scroller, &Scroller::scroll,
-		this, &DateTimePicker::_q_scroll );
-
-	connect( d->scroller, &Scroller::finished,
-		this, &DateTimePicker::_q_scrollFinished );
 }
 
 DateTimePicker::DateTimePicker( const QTime & time, QWidget * parent )
 	:	QWidget( parent )
 	,	d( new DateTimePickerPrivate( this, QMetaType::QTime ) )
 {
-	setSizePolicy( QSizePolicy( QSizePolicy::Fixed,
-		QSizePolicy::Fixed ) );
+	d->init();
 
 	setTime( time.isValid() ? time : DATETIMEPICKER_TIME_MIN );
+}
 
-	connect( d->scroller, &Scroller::aboutToStart,
-		this, &DateTimePicker::_q_scrollAboutToStart );
-
-	connect( d->scroller, &Scroller::scroll,
-		this, &DateTimePicker::_q_scroll );
-
-	connect( d->scroller, &Scroller::finished,
-		this, &DateTimePicker::_q_scrollFinished );
+DateTimePicker::DateTimePicker( const DateTimeFormat & format, QWidget * parent )
+	:	QWidget( parent )
+	,	d( new DateTimePickerPrivate( this, QMetaType::QDateTime, format ) )
+{
+	d->init();
 }
 
 DateTimePicker::DateTimePicker( const QVariant & val, QMetaType::Type parserType,
 	QWidget * parent )
+	:	DateTimePicker( val, parserType, DateTimeParser::defaultFormat, parent )
+{
+}
+
+DateTimePicker::DateTimePicker( const QVariant & val, QMetaType::Type parserType,
+	const DateTimeFormat & format, QWidget * parent )
 	:	QWidget( parent )
-	,	d( new DateTimePickerPrivate( this, parserType ) )
+	,	d( new DateTimePickerPrivate( this, parserType, format ) )
 {
-	setSizePolicy( QSizePolicy( QSizePolicy::Fixed,
-		QSizePolicy::Fixed ) );
+	d->init();
 
 	switch( val.metaType().id() )
 	{
@@ -724,15 +607,6 @@ DateTimePicker::DateTimePicker( const QVariant & val, QMetaType::Type parserType
 			setDateTime( QDateTime( DATETIMEPICKER_DATE_INITIAL,
 				DATETIMEPICKER_TIME_MIN ) );
 	}
-
-	connect( d->scroller, &Scroller::aboutToStart,
-		this, &DateTimePicker::_q_scrollAboutToStart );
-
-	connect( d->scroller, &Scroller::scroll,
-		this, &DateTimePicker::_q_scroll );
-
-	connect( d->scroller, &Scroller::finished,
-		this, &DateTimePicker::_q_scrollFinished );
 }
 
 DateTimePicker::~DateTimePicker()
@@ -742,25 +616,25 @@ DateTimePicker::~DateTimePicker()
 QDateTime
 DateTimePicker::dateTime() const
 {
-	return d->value;
+	return d->toDateTime( d->liveValid ? d->liveFields : d->value );
 }
 
 QDate
 DateTimePicker::date() const
 {
-	return d->value.date();
+	return dateTime().date();
 }
 
 QTime
 DateTimePicker::time() const
 {
-	return d->value.time();
+	return dateTime().time();
 }
 
 QDateTime
 DateTimePicker::minimumDateTime() const
 {
-	return d->minimum;
+	return d->toDateTime( d->minimum );
 }
 
 void
@@ -774,16 +648,13 @@ void
 DateTimePicker::setMinimumDateTime( const QDateTime & dt )
 {
 	if( dt.isValid() && dt.date() >= DATETIMEPICKER_DATE_MIN )
-	{
-		const QDateTime m = dt.toTimeSpec( d->spec );
-		d->setRange( m, ( d->maximum > m ? d->maximum : m ) );
-	}
+		d->setMinimum( d->toFields( dt ) );
 }
 
 QDateTime
 DateTimePicker::maximumDateTime() const
 {
-	return d->maximum;
+	return d->toDateTime( d->maximum );
 }
 
 void
@@ -796,17 +667,14 @@ void
 DateTimePicker::setMaximumDateTime( const QDateTime & dt )
 {
 	if( dt.isValid() && dt.date() <= DATETIMEPICKER_DATE_MAX )
-	{
-		const QDateTime m = dt.toTimeSpec( d->spec );
-		d->setRange( ( d->minimum < m ? d->minimum : m ), m );
-	}
+		d->setMaximum( d->toFields( dt ) );
 }
 
 void
 DateTimePicker::setDateTimeRange( const QDateTime & min, const QDateTime & max )
 {
-	const QDateTime minimum = min.toTimeSpec( d->spec );
-	QDateTime maximum = max.toTimeSpec( d->spec );
+	const DateTimeFields minimum = d->toFields( min );
+	DateTimeFields maximum = d->toFields( max );
 	if( min > max )
 		maximum = minimum;
 	d->setRange( minimum, maximum );
@@ -822,7 +690,11 @@ void
 DateTimePicker::setMinimumDate( const QDate & min )
 {
 	if( min.isValid() && min >= DATETIMEPICKER_DATE_MIN )
-		setMinimumDateTime( QDateTime( min, d->minimum.time(), d->spec ) );
+	{
+		DateTimeFields m = d->minimum;
+		m.setDate( min );
+		d->setMinimum( m );
+	}
 }
 
 void
@@ -840,8 +712,12 @@ DateTimePicker::maximumDate() const
 void
 DateTimePicker::setMaximumDate( const QDate & max )
 {
-	if( max.isValid() )
-		setMaximumDateTime( QDateTime( max, d->maximum.time(), d->spec ) );
+	if( max.isValid() && max <= DATETIMEPICKER_DATE_MAX )
+	{
+		DateTimeFields m = d->maximum;
+		m.setDate( max );
+		d->setMaximum( m );
+	}
 }
 
 void
@@ -854,8 +730,15 @@ void
 DateTimePicker::setDateRange( const QDate & min, const QDate & max )
 {
 	if( min.isValid() && max.isValid() )
-		setDateTimeRange( QDateTime( min, d->minimum.time(), d->spec ),
-			QDateTime( max, d->maximum.time(), d->spec ) );
+	{
+		DateTimeFields minimum = d->minimum;
+		minimum.setDate( min );
+		DateTimeFields maximum = d->maximum;
+		maximum.setDate( max );
+		if( maximum < minimum )
+			maximum = minimum;
+		d->setRange( minimum, maximum );
+	}
 }
 
 QTime
@@ -869,8 +752,9 @@ DateTimePicker::setMinimumTime( const QTime & min )
 {
 	if( min.isValid() )
 	{
-		const QDateTime m( d->minimum.date(), min, d->spec );
-		setMinimumDateTime( m );
+		DateTimeFields m = d->minimum;
+		m.setTime( min );
+		d->setMinimum( m );
 	}
 }
 
@@ -891,8 +775,9 @@ DateTimePicker::setMaximumTime( const QTime & max )
 {
 	if( max.isValid() )
 	{
-		const QDateTime m( d->maximum.date(), max, d->spec );
-		setMaximumDateTime( m );
+		DateTimeFields m = d->maximum;
+		m.setTime( max );
+		d->setMaximum( m );
 	}
 }
 
@@ -906,8 +791,15 @@ void
 DateTimePicker::setTimeRange( const QTime & min, const QTime & max )
 {
 	if( min.isValid() && max.isValid() )
-		setDateTimeRange( QDateTime( d->minimum.date(), min, d->spec ),
-			QDateTime( d->maximum.date(), max, d->spec ) );
+	{
+		DateTimeFields minimum = d->minimum;
+		minimum.setTime( min );
+		DateTimeFields maximum = d->maximum;
+		maximum.setTime( max );
+		if( maximum < minimum )
+			maximum = minimum;
+		d->setRange( minimum, maximum );
+	}
 }
 
 QString
@@ -939,9 +831,41 @@ DateTimePicker::setTimeSpec( Qt::TimeSpec spec )
 {
 	if( spec != d->spec )
 	{
+		const Qt::TimeSpec oldSpec = d->spec;
 		d->spec = spec;
-		d->updateTimeSpec();
+		d->updateTimeSpec( oldSpec );
+	}
+}
+
+DateTimePicker::SignalPolicy
+DateTimePicker::signalPolicy() const
+{
+	return d->signalPolicy;
+}
+
+void
+DateTimePicker::setSignalPolicy( SignalPolicy policy )
+{
+	d->signalPolicy = policy;
+}
+
+int
+DateTimePicker::throttleRate() const
+{
+	return d->throttleRate;
+}
+
+void
+DateTimePicker::setThrottleRate( int hz )
+{
+	if( hz <= 0 )
+	{
+		qWarning( "QtMWidgets::DateTimePicker::setThrottleRate: "
+			"Invalid rate (%d) must be > 0", hz );
+		return;
 	}
+
+	d->throttleRate = hz;
 }
 
 Scroller *
@@ -950,21 +874,32 @@ DateTimePicker::scroller() const
 	return d->scroller;
 }
 
+MemoryUsage
+DateTimePicker::memoryUsage() const
+{
+	MemoryUsage u;
+	u.add( MemoryUsage::Data, widgetBytes( sizeof( DateTimePicker ) ) +
+		sizeof( DateTimePickerPrivate ) - sizeof( PickerSectionsStyleTokens ) );
+	u.add( MemoryUsage::Caches, sizeof( PickerSectionsStyleTokens ) );
+	u.add( MemoryUsage::Animations,
+		sizeof( Scroller ) + sizeof( QVariantAnimation ) );
+
+	if( d->throttleTimer )
+		u.add( MemoryUsage::Animations, sizeof( QTimer ) );
+
+	foreach( const Section & s, d->sections )
+		u.add( MemoryUsage::Data, estimatedBytes( s.values ) );
+
+	return u;
+}
+
 QSize
 DateTimePicker::sizeHint() const
 {
 	QStyleOption opt;
 	opt.initFrom( this );
 
-	d->itemHeight = opt.fontMetrics.boundingRect( QLatin1String( "AM" ) )
-		.height();
-
-	d->itemTopMargin = d->itemHeight / 3;
-
-	d->widgetHeight = d->itemHeight * d->itemsMaxCount +
-		( d->itemsMaxCount - 1 ) * d->itemTopMargin;
-
-	d->currentItemY = d->widgetHeight / 2 - d->itemHeight / 2;
+	d->computeItemsGeometry( opt );
 
 	int widgetWidth = 0;
 
@@ -982,21 +917,29 @@ void
 DateTimePicker::setDateTime( const QDateTime & dateTime )
 {
 	if( dateTime.isValid() )
-		d->setValue( dateTime.toTimeSpec( d->spec ) );
+		d->setValue( d->toFields( dateTime ) );
 }
 
 void
 DateTimePicker::setDate( const QDate & date )
 {
 	if( date.isValid() )
-		d->setValue( QDateTime( date, d->value.time(), d->spec ) );
+	{
+		DateTimeFields f = d->value;
+		f.setDate( date );
+		d->setValue( f );
+	}
 }
 
 void
 DateTimePicker::setTime( const QTime & time )
 {
 	if( time.isValid() )
-		d->setValue( QDateTime( d->value.date(), time, d->spec ) );
+	{
+		DateTimeFields f = d->value;
+		f.setTime( time );
+		d->setValue( f );
+	}
 }
 
 void
@@ -1015,6 +958,7 @@ DateTimePicker::wheelEvent( QWheelEvent * event )
 
 		if( numDegrees.y() != 0 )
 		{
+			d->stopLive();
 			d->normalizeOffsets();
 			d->clearOffset();
 			d->updateDaysIfNeeded();
@@ -1052,6 +996,7 @@ DateTimePicker::mouseMoveEvent( QMouseEvent * event )
 	{
 		const int delta = event->pos().y() - d->mousePos.y();
 		d->updateOffset( delta );
+		d->scrollStep();
 		d->mousePos = event->pos();
 		update();
 
@@ -1080,8 +1025,8 @@ DateTimePicker::paintEvent( QPaintEvent * )
 {
 	d->normalizeOffsets();
 
-	QStyleOption opt;
-	opt.initFrom( this );
+	const PickerSectionsStyleTokens & t = d->styleTokens();
+	const QStyleOption & opt = t.option;
 
 	QPainter p( this );
 
@@ -1091,10 +1036,10 @@ DateTimePicker::paintEvent( QPaintEvent * )
 	{
 		const QRect r( x, 0, d->sections.at( i ).sectionWidth, d->widgetHeight );
 
-		drawCylinder( &p, r, palette().color( QPalette::Dark ),
+		drawCylinder( &p, r, t.cylinder,
 			( i == 0 ), ( i == d->sections.size() - 1 ) );
 
-		d->drawSectionItems( i, &p, opt );
+		d->drawSectionItems( i, &p );
 
 		x += d->sections.at( i ).sectionWidth;
 	}
@@ -1108,6 +1053,7 @@ DateTimePicker::_q_scroll( int dx, int dy )
 	Q_UNUSED( dx )
 
 	d->updateOffset( dy );
+	d->scrollStep();
 
 	update();
 }
@@ -1126,4 +1072,24 @@ DateTimePicker::_q_scrollFinished()
 	d->releaseScrolling();
 }
 
+void
+DateTimePicker::_q_emitThrottled()
+{
+	if( d->livePending )
+	{
+		d->emitLive();
+
+		d->throttleTimer->start();
+	}
+}
+
+void
+DateTimePicker::changeEvent( QEvent * event )
+{
+	if( StyleTokens::isInvalidatedBy( event ) )
+		d->tokens.invalidate();
+
+	QWidget::changeEvent( event );
+}
+
 } /* namespace QtMWidgets */
@@ -13,6 +13,10 @@
 #include <QVariant>
 #include <QDateTime>
 
+// QtMWidgets include.
+#include "datetimeformat.hpp"
+#include "memoryusage.hpp"
+
 
 namespace QtMWidgets {
 
@@ -188,6 +192,28 @@ class DateTimePicker
 		\brief the current timespec used by the date time picker
 	*/
 	Q_PROPERTY( Qt::TimeSpec timeSpec READ timeSpec WRITE setTimeSpec )
+	/*!
+		\property signalPolicy
+
+		\brief when change signals are emitted while the user scrolls
+		the sections
+
+		By default, this property is EmitOnSettle.
+
+		\sa throttleRate
+	*/
+	Q_PROPERTY( SignalPolicy signalPolicy READ signalPolicy WRITE setSignalPolicy )
+	/*!
+		\property throttleRate
+
+		\brief the maximum rate of change signals per second while
+		scrolling with the EmitThrottled signal policy
+
+		By default, this property contains a value of 10.
+
+		\sa signalPolicy
+	*/
+	Q_PROPERTY( int throttleRate READ throttleRate WRITE setThrottleRate )
 
 signals:
 	/*!
@@ -207,10 +233,32 @@ signals:
 	void dateChanged( const QDate & date );
 
 public:
+	//! When change signals are emitted while the user scrolls.
+	enum SignalPolicy {
+		//! Signals are emitted only when scrolling is finished.
+		EmitOnSettle = 0,
+		/*!
+			Signals are emitted while scrolling, but not more often
+			than throttleRate times per second.
+		*/
+		EmitThrottled = 1,
+		//! Signals are emitted on every change while scrolling.
+		EmitLive = 2
+	}; // enum SignalPolicy
+
+	Q_ENUM( SignalPolicy )
+
 	explicit DateTimePicker( QWidget * parent = 0 );
 	explicit DateTimePicker( const QDateTime & dt, QWidget * parent = 0 );
 	explicit DateTimePicker( const QDate & date, QWidget * parent = 0 );
 	explicit DateTimePicker( const QTime & time, QWidget * parent = 0 );
+	/*!
+		Construct picker with sections from the compile-time \a format
+		descriptor, format string is not parsed.
+
+		\sa DateTimeFormat
+	*/
+	explicit DateTimePicker( const DateTimeFormat & format, QWidget * parent = 0 );
 
 	virtual ~DateTimePicker();
 
@@ -397,7 +445,8 @@ public:
 		if you defined "mm" in the format string then there can't be "m",
 		otherwise format will not be parsed.
 
-		In format string possible to use space character, it will be simple
+		In format string possible to use space and separator characters
+		(".", ":", "-", "/", ","), they will be simple
 		ignored. In which order sections will be defined in that they will
 		appear in the widget. I.e. format string "yyyy MM dd" mean that widget
 		will have thre sections/cylinders, where first will display year in four
@@ -430,6 +479,8 @@ public:
 		s          | the second without a leading zero (0 to 59)
 		ss         | the second with a leading zero (00 to 59)
 		a          | Interpret as an AM/PM time. ap must be either "AM" or "PM".
+
+		\sa DateTimeFormat
 	*/
 	void setFormat( const QString & format );
 
@@ -446,9 +497,38 @@ public:
 	*/
 	void setTimeSpec( Qt::TimeSpec spec );
 
+	/*!
+		\return Signal policy.
+
+		\sa signalPolicy.
+	*/
+	SignalPolicy signalPolicy() const;
+	/*!
+		Set signal policy.
+
+		\sa signalPolicy.
+	*/
+	void setSignalPolicy( SignalPolicy policy );
+
+	/*!
+		\return Maximum rate of change signals while scrolling.
+
+		\sa throttleRate.
+	*/
+	int throttleRate() const;
+	/*!
+		Set maximum rate of change signals while scrolling, must be > 0.
+
+		\sa throttleRate.
+	*/
+	void setThrottleRate( int hz );
+
 	//! \return Scroller interface.
 	Scroller * scroller() const;
 
+	//! \return Approximate memory owned by the picker.
+	MemoryUsage memoryUsage() const;
+
 	QSize sizeHint() const override;
 
 public slots:
@@ -477,14 +557,18 @@ protected:
 	void mouseMoveEvent( QMouseEvent * event ) override;
 	void mouseReleaseEvent( QMouseEvent * event ) override;
 	void paintEvent( QPaintEvent * event ) override;
+	void changeEvent( QEvent * event ) override;
 
 	DateTimePicker( const QVariant & val, QMetaType::Type parserType,
 		QWidget * parent = 0 );
+	DateTimePicker( const QVariant & val, QMetaType::Type parserType,
+		const DateTimeFormat & format, QWidget * parent = 0 );
 
 private slots:
 	void _q_scroll( int dx, int dy );
 	void _q_scrollAboutToStart();
 	void _q_scrollFinished();
+	void _q_emitThrottled();
 
 private:
 	friend class DateTimePickerPrivate;
@@ -0,0 +1,664 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "imagelistview.hpp"
+#include "private/imagelistview_p.hpp"
+
+// Qt include.
+#include <QImageReader>
+#include <QMetaObject>
+#include <QMutexLocker>
+#include <QPainter>
+#include <QThread>
+#include <QTimer>
+
+
+namespace QtMWidgets {
+
+//! Default byte budget of full quality images.
+static const qint64 c_imageCacheBytes = 16 * 1024 * 1024;
+//! Full quality images are decoded this count of viewports around.
+static const int c_imageScreens = 1;
+//! Thumbnails are decoded this count of viewports around.
+static const int c_thumbnailScreens = 4;
+
+//! \return \a size fit into \a bounds keeping aspect ratio, never scaled up.
+static QSize fitSize( const QSize & size, const QSize & bounds )
+{
+	if( size.width() > bounds.width() || size.height() > bounds.height() )
+		return size.scaled( bounds, Qt::KeepAspectRatio );
+	else
+		return size;
+}
+
+/*!
+	Read image from the \a fileName scaled down to \a maxSize,
+	\a size is set to the size of the image in the file.
+*/
+static QImage readImage( const QString & fileName, const QSize & maxSize,
+	QSize * size )
+{
+	QImageReader reader( fileName );
+
+	*size = reader.size();
+
+	// Decoders like JPEG decode scaled down image much faster.
+	if( size->isValid() )
+		reader.setScaledSize( fitSize( *size, maxSize ) );
+
+	QImage image = reader.read();
+
+	if( !size->isValid() && !image.isNull() )
+	{
+		*size = image.size();
+
+		image = image.scaled( fitSize( *size, maxSize ),
+			Qt::KeepAspectRatio, Qt::SmoothTransformation );
+	}
+
+	return image;
+}
+
+//! \return Compact thumbnail of the \a image.
+static QImage makeThumbnail( const QImage & image, const QSize & maxSize )
+{
+	if( image.isNull() )
+		return QImage();
+
+	const QImage thumbnail = image.scaled( fitSize( image.size(), maxSize ),
+		Qt::KeepAspectRatio, Qt::SmoothTransformation );
+
+	return thumbnail.convertToFormat( thumbnail.hasAlphaChannel() ?
+		QImage::Format_ARGB32_Premultiplied : QImage::Format_RGB16 );
+}
+
+
+//
+// ImageDecoder
+//
+
+ImageDecoder::ImageDecoder( const Callback & callback )
+	:	m_callback( callback )
+	,	m_workers( 0 )
+{
+	// One core is left to the GUI thread.
+	m_pool.setMaxThreadCount( qMax( 1, QThread::idealThreadCount() - 1 ) );
+}
+
+ImageDecoder::~ImageDecoder()
+{
+	stop();
+}
+
+void
+ImageDecoder::setSizes( const QSize & imageSize, const QSize & thumbnailSize )
+{
+	QMutexLocker lock( &m_mutex );
+
+	m_imageSize = imageSize;
+	m_thumbnailSize = thumbnailSize;
+}
+
+void
+ImageDecoder::setRequests( const QVector< ImageDecodeRequest > & requests )
+{
+	QMutexLocker lock( &m_mutex );
+
+	m_queue.clear();
+
+	foreach( const ImageDecodeRequest & r, requests )
+	{
+		if( !m_inProgress.contains( r.fileName ) )
+			m_queue.append( r );
+	}
+
+	while( m_workers < m_pool.maxThreadCount() && m_workers < m_queue.count() )
+	{
+		++m_workers;
+
+		m_pool.start( new ImageDecodeWorker( this ) );
+	}
+}
+
+void
+ImageDecoder::stop()
+{
+	{
+		QMutexLocker lock( &m_mutex );
+
+		m_queue.clear();
+	}
+
+	m_pool.waitForDone();
+}
+
+void
+ImageDecoder::work()
+{
+	ImageDecodeRequest request;
+	QSize imageSize;
+	QSize thumbnailSize;
+
+	while( takeRequest( &request, &imageSize, &thumbnailSize ) )
+	{
+		ImageDecodeResult result;
+		result.fileName = request.fileName;
+		result.row = request.row;
+		result.generation = request.generation;
+
+		// Only thumbnail is decoded right in its size, it's much cheaper.
+		const QImage image = readImage( request.fileName,
+			( request.thumbnail ? thumbnailSize : imageSize ), &result.size );
+
+		result.thumbnail = makeThumbnail( image, thumbnailSize );
+
+		if( !request.thumbnail )
+			result.image = image;
+
+		m_callback( result );
+
+		QMutexLocker lock( &m_mutex );
+
+		m_inProgress.remove( request.fileName );
+	}
+}
+
+bool
+ImageDecoder::takeRequest( ImageDecodeRequest * request,
+	QSize * imageSize, QSize * thumbnailSize )
+{
+	QMutexLocker lock( &m_mutex );
+
+	if( m_queue.isEmpty() )
+	{
+		--m_workers;
+
+		return false;
+	}
+
+	*request = m_queue.takeFirst();
+	*imageSize = m_imageSize;
+	*thumbnailSize = m_thumbnailSize;
+
+	m_inProgress.insert( request->fileName );
+
+	return true;
+}
+
+
+//
+// ImageListViewPrivate
+//
+
+ImageListViewPrivate::ImageListViewPrivate( ImageListView * parent )
+	:	AbstractListViewPrivate< QString > ( parent )
+	,	maxImageSize( 256, 256 )
+	,	thumbnailSize( 32, 32 )
+	,	thumbnailBytes( 0 )
+	,	generation( 0 )
+	,	pruneNeeded( false )
+	,	images( new LruCache< QString, QImage > (
+			QStringLiteral( "ImageListView" ), c_imageCacheBytes ) )
+	,	decodeTimer( 0 )
+{
+}
+
+ImageListViewPrivate::~ImageListViewPrivate()
+{
+}
+
+void
+ImageListViewPrivate::initView()
+{
+	ImageListView * q = q_func();
+
+	decodeTimer = new QTimer( q );
+	decodeTimer->setSingleShot( true );
+	decodeTimer->setInterval( 0 );
+
+	QObject::connect( decodeTimer, &QTimer::timeout,
+		q, [this] () { requestImages(); } );
+
+	// Results are passed to the GUI thread, they are dropped with the view.
+	decoder.reset( new ImageDecoder( [q] ( const ImageDecodeResult & result )
+		{
+			QMetaObject::invokeMethod( q,
+				[q, result] () { q->d_func()->imageDecoded( result ); },
+				Qt::QueuedConnection );
+		} ) );
+
+	decoder->setSizes( maxImageSize, thumbnailSize );
+
+	// Images of the visible rows are decoded when interaction finished.
+	QObject::connect( q, &AbstractScrollArea::interactingChanged,
+		q, [this] ( bool on ) { if( !on ) scheduleDecoding(); } );
+}
+
+QSize
+ImageListViewPrivate::imageSize( const QString & fileName,
+	const QSize & bounds ) const
+{
+	QHash< QString, Thumbnail >::const_iterator it =
+		thumbnails.constFind( fileName );
+
+	// Image is a square until its size is known.
+	const QSize size = ( it != thumbnails.constEnd() && it->size.isValid() ?
+		it->size : maxImageSize );
+
+	return fitSize( size, bounds.boundedTo( maxImageSize ) );
+}
+
+void
+ImageListViewPrivate::scheduleDecoding()
+{
+	if( !decodeTimer->isActive() )
+		decodeTimer->start();
+}
+
+void
+ImageListViewPrivate::requestImages()
+{
+	const ImageListView * q = q_func();
+
+	if( pruneNeeded )
+		pruneImages();
+
+	QVector< ImageDecodeRequest > requests;
+
+	const QVector< int > visible = visibleRows();
+
+	if( !model || visible.isEmpty() )
+	{
+		decoder->setRequests( requests );
+
+		return;
+	}
+
+	const int count = model->rowCount();
+	qint64 bytes = 0;
+
+	// Appends request if the image is missing and fits \a limit bytes.
+	const auto request = [&] ( int row, bool thumbnail, qint64 limit )
+	{
+		if( row < 0 || row >= count )
+			return;
+
+		const QString & fileName = model->data( row );
+
+		if( images->contains( fileName ) )
+			return;
+
+		QHash< QString, Thumbnail >::const_iterator it =
+			thumbnails.constFind( fileName );
+
+		if( it != thumbnails.constEnd() &&
+			( thumbnail || it->image.isNull() ) )
+				return;
+
+		if( !thumbnail )
+		{
+			const QSize s = imageSize( fileName, maxImageSize );
+			const qint64 cost = static_cast< qint64 > ( s.width() ) *
+				s.height() * 4;
+
+			if( bytes + cost > limit )
+				return;
+
+			bytes += cost;
+		}
+
+		ImageDecodeRequest r;
+		r.fileName = fileName;
+		r.row = row;
+		r.generation = generation;
+		r.thumbnail = thumbnail;
+
+		requests.append( r );
+	};
+
+	const int first = visible.first();
+	const int last = visible.last();
+	const int screen = visible.count();
+
+	// Thumbnails of the visible rows are cheap and shown at once.
+	foreach( int row, visible )
+		request( row, true, 0 );
+
+	if( !q->isInteracting() )
+	{
+		// Images not fitting the budget would evict each other forever.
+		foreach( int row, visible )
+			request( row, false, images->maxBytes() );
+
+		for( int i = 1; i <= screen * c_imageScreens; ++i )
+		{
+			request( last + i, false, images->maxBytes() / 2 );
+			request( first - i, false, images->maxBytes() / 2 );
+		}
+	}
+
+	for( int i = 1; i <= screen * c_thumbnailScreens; ++i )
+	{
+		request( last + i, true, 0 );
+		request( first - i, true, 0 );
+	}
+
+	decoder->setRequests( requests );
+}
+
+void
+ImageListViewPrivate::imageDecoded( const ImageDecodeResult & result )
+{
+	ImageListView * q = q_func();
+
+	// Image of the old size, the file is requested again.
+	if( result.generation != generation )
+	{
+		scheduleDecoding();
+
+		return;
+	}
+
+	Thumbnail & t = thumbnails[ result.fileName ];
+
+	const bool resized = ( t.size != result.size );
+
+	thumbnailBytes += estimatedBytes( result.thumbnail ) -
+		estimatedBytes( t.image );
+
+	t.image = result.thumbnail;
+	t.size = result.size;
+
+	if( !result.image.isNull() )
+		images->insert( result.fileName, new QImage( result.image ),
+			estimatedBytes( result.image ) );
+
+	if( model && result.row < model->rowCount() &&
+		model->data( result.row ) == result.fileName )
+			q->AbstractListView< QString >::dataChanged( result.row,
+				result.row, ( resized ? AbstractListModel::LayoutChange :
+					AbstractListModel::PaintOnlyChange ) );
+}
+
+void
+ImageListViewPrivate::resetImages()
+{
+	ImageListView * q = q_func();
+
+	++generation;
+
+	images->clear();
+
+	decoder->setSizes( maxImageSize, thumbnailSize );
+
+	q->recalculateSize();
+
+	viewport->update();
+}
+
+void
+ImageListViewPrivate::schedulePruning()
+{
+	pruneNeeded = true;
+
+	scheduleDecoding();
+}
+
+void
+ImageListViewPrivate::pruneImages()
+{
+	pruneNeeded = false;
+
+	QSet< QString > files;
+
+	if( model )
+	{
+		for( int i = 0, last = model->rowCount(); i < last; ++i )
+			files.insert( model->data( i ) );
+	}
+
+	QHash< QString, Thumbnail >::iterator it = thumbnails.begin();
+
+	while( it != thumbnails.end() )
+	{
+		if( !files.contains( it.key() ) )
+		{
+			thumbnailBytes -= estimatedBytes( it->image );
+
+			images->remove( it.key() );
+
+			it = thumbnails.erase( it );
+		}
+		else
+			++it;
+	}
+}
+
+
+//
+// ImageListView
+//
+
+ImageListView::ImageListView( QWidget * parent )
+	:	AbstractListView< QString > ( new ImageListViewPrivate( this ), parent )
+{
+	ImageListViewPrivate * d = d_func();
+
+	d->initView();
+}
+
+ImageListView::~ImageListView()
+{
+	ImageListViewPrivate * d = d_func();
+
+	d->decodeTimer->stop();
+	d->decoder->stop();
+}
+
+void
+ImageListView::setModel( ListModel< QString > * m )
+{
+	AbstractListView< QString >::setModel( m );
+
+	ImageListViewPrivate * d = d_func();
+
+	d->schedulePruning();
+}
+
+QSize
+ImageListView::maxImageSize() const
+{
+	const ImageListViewPrivate * d = d_func();
+
+	return d->maxImageSize;
+}
+
+void
+ImageListView::setMaxImageSize( const QSize & s )
+{
+	ImageListViewPrivate * d = d_func();
+
+	if( s.isEmpty() )
+	{
+		qWarning( "QtMWidgets::ImageListView::setMaxImageSize: "
+			"size should not be empty" );
+
+		return;
+	}
+
+	if( d->maxImageSize != s )
+	{
+		d->maxImageSize = s;
+
+		d->resetImages();
+	}
+}
+
+QSize
+ImageListView::thumbnailSize() const
+{
+	const ImageListViewPrivate * d = d_func();
+
+	return d->thumbnailSize;
+}
+
+void
+ImageListView::setThumbnailSize( const QSize & s )
+{
+	ImageListViewPrivate * d = d_func();
+
+	if( s.isEmpty() )
+	{
+		qWarning( "QtMWidgets::ImageListView::setThumbnailSize: "
+			"size should not be empty" );
+
+		return;
+	}
+
+	d->thumbnailSize = s;
+
+	d->decoder->setSizes( d->maxImageSize, d->thumbnailSize );
+}
+
+qint64
+ImageListView::imageCacheBytes() const
+{
+	const ImageListViewPrivate * d = d_func();
+
+	return d->images->maxBytes();
+}
+
+void
+ImageListView::setImageCacheBytes( qint64 bytes )
+{
+	ImageListViewPrivate * d = d_func();
+
+	d->images->setMaxBytes( bytes );
+
+	d->scheduleDecoding();
+}
+
+QImage
+ImageListView::thumbnail( int row ) const
+{
+	const ImageListViewPrivate * d = d_func();
+
+	if( !d->model || row < 0 || row >= d->model->rowCount() )
+		return QImage();
+
+	return d->thumbnails.value( d->model->data( row ) ).image;
+}
+
+bool
+ImageListView::isImageLoaded( int row ) const
+{
+	const ImageListViewPrivate * d = d_func();
+
+	if( !d->model || row < 0 || row >= d->model->rowCount() )
+		return false;
+
+	return d->images->contains( d->model->data( row ) );
+}
+
+MemoryUsage
+ImageListView::memoryUsage() const
+{
+	const ImageListViewPrivate * d = d_func();
+
+	MemoryUsage u = AbstractListView< QString >::memoryUsage();
+
+	u.add( MemoryUsage::Caches, d->images->usedBytes() + d->thumbnailBytes );
+
+	return u;
+}
+
+void
+ImageListView::drawRow( QPainter * painter, const QRect & rect, int row )
+{
+	ImageListViewPrivate * d = d_func();
+
+	const QString & fileName = d->model->data( row );
+
+	QRect r( QPoint( 0, 0 ), d->imageSize( fileName, rect.size() ) );
+	r.moveCenter( rect.center() );
+
+	const QImage * image = d->images->object( fileName );
+
+	if( image )
+	{
+		painter->drawImage( r, *image );
+
+		return;
+	}
+
+	// Thumbnail is the level of detail until the image is decoded.
+	QHash< QString, ImageListViewPrivate::Thumbnail >::const_iterator it =
+		d->thumbnails.constFind( fileName );
+
+	if( it != d->thumbnails.constEnd() && !it->image.isNull() )
+		painter->drawImage( r, it->image );
+	else
+		painter->fillRect( r, palette().color( QPalette::Midlight ) );
+
+	d->scheduleDecoding();
+}
+
+int
+ImageListView::rowHeightForWidth( int row, int width ) const
+{
+	const ImageListViewPrivate * d = d_func();
+
+	const QString & fileName = d->model->data( row );
+
+	if( orientation() == Qt::Horizontal )
+		return d->imageSize( fileName, QSize( INT_MAX, width ) ).width();
+	else
+		return d->imageSize( fileName, QSize( width, INT_MAX ) ).height();
+}
+
+void
+ImageListView::scrollContentsBy( int dx, int dy )
+{
+	AbstractListView< QString >::scrollContentsBy( dx, dy );
+
+	ImageListViewPrivate * d = d_func();
+
+	d->scheduleDecoding();
+}
+
+void
+ImageListView::dataChanged( int first, int last,
+	QtMWidgets::AbstractListModel::ChangeHint hint )
+{
+	AbstractListView< QString >::dataChanged( first, last, hint );
+
+	ImageListViewPrivate * d = d_func();
+
+	d->schedulePruning();
+}
+
+void
+ImageListView::modelReset()
+{
+	AbstractListView< QString >::modelReset();
+
+	ImageListViewPrivate * d = d_func();
+
+	d->schedulePruning();
+}
+
+void
+ImageListView::rowsRemoved( int first, int last )
+{
+	AbstractListView< QString >::rowsRemoved( first, last );
+
+	ImageListViewPrivate * d = d_func();
+
+	d->schedulePruning();
+}
+
+} /* namespace QtMWidgets */
@@ -0,0 +1,134 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__IMAGELISTVIEW_HPP__INCLUDED
+#define QTMWIDGETS__IMAGELISTVIEW_HPP__INCLUDED
+
+// QtMWidgets include.
+#include "abstractlistview.hpp"
+
+// Qt include.
+#include <QImage>
+
+
+namespace QtMWidgets {
+
+//
+// ImageListView
+//
+
+class ImageListViewPrivate;
+
+/*!
+	ImageListView shows images from the files, names of the files
+	are rows of the model.
+
+	For every row shown once small thumbnail is kept, it's used as
+	the level of detail while the row is scrolled in and its size
+	gives height of the row. Full quality images are kept only for
+	the rows near the viewport, least recently shown images are
+	evicted when imageCacheBytes budget is exceeded.
+
+	Images are decoded on the worker threads in visibility order:
+	thumbnails of the visible rows first, then images of the visible
+	rows and images of the rows around the viewport. While the view
+	is interacting only thumbnails are decoded.
+*/
+class ImageListView
+	:	public AbstractListView< QString >
+{
+	Q_OBJECT
+
+	/*!
+		\property maxImageSize
+
+		This property holds the maximum size of the image, larger
+		images are scaled down keeping aspect ratio.
+
+		By default, this property is 256x256.
+	*/
+	Q_PROPERTY( QSize maxImageSize READ maxImageSize WRITE setMaxImageSize )
+	/*!
+		\property thumbnailSize
+
+		This property holds the maximum size of the thumbnail.
+		Changing this property affects thumbnails decoded later.
+
+		By default, this property is 32x32.
+	*/
+	Q_PROPERTY( QSize thumbnailSize READ thumbnailSize
+		WRITE setThumbnailSize )
+	/*!
+		\property imageCacheBytes
+
+		This property holds the byte budget of full quality images.
+
+		By default, this property is 16 MB.
+	*/
+	Q_PROPERTY( qint64 imageCacheBytes READ imageCacheBytes
+		WRITE setImageCacheBytes )
+
+public:
+	explicit ImageListView( QWidget * parent = 0 );
+	virtual ~ImageListView();
+
+	/*!
+		Set model with the file names. Images of the files not in the
+		model are dropped.
+	*/
+	void setModel( ListModel< QString > * m );
+
+	//! \return Maximum size of the image.
+	QSize maxImageSize() const;
+	//! Set maximum size of the image.
+	void setMaxImageSize( const QSize & s );
+
+	//! \return Maximum size of the thumbnail.
+	QSize thumbnailSize() const;
+	//! Set maximum size of the thumbnail.
+	void setThumbnailSize( const QSize & s );
+
+	//! \return Byte budget of full quality images.
+	qint64 imageCacheBytes() const;
+	//! Set byte budget of full quality images.
+	void setImageCacheBytes( qint64 bytes );
+
+	//! \return Thumbnail of the \a row, null if it was not decoded yet.
+	QImage thumbnail( int row ) const;
+	//! \return Is full quality image of the \a row in the cache.
+	bool isImageLoaded( int row ) const;
+
+	/*!
+		\return Approximate memory owned by the view, thumbnails and
+		images are reported as caches.
+	*/
+	MemoryUsage memoryUsage() const override;
+
+protected:
+	void drawRow( QPainter * painter, const QRect & rect, int row ) override;
+	int rowHeightForWidth( int row, int width ) const override;
+	void scrollContentsBy( int dx, int dy ) override;
+	void dataChanged( int first, int last,
+		QtMWidgets::AbstractListModel::ChangeHint hint =
+			QtMWidgets::AbstractListModel::LayoutChange ) override;
+	void modelReset() override;
+	void rowsRemoved( int first, int last ) override;
+
+private:
+	friend class ImageListViewPrivate;
+
+	inline ImageListViewPrivate * d_func()
+		{ return reinterpret_cast< ImageListViewPrivate* > ( d.data() ); }
+	inline const ImageListViewPrivate * d_func() const
+		{ return reinterpret_cast< const ImageListViewPrivate* >
+			( d.data() ); }
+
+	Q_DISABLE_COPY( ImageListView )
+}; // class ImageListView
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__IMAGELISTVIEW_HPP__INCLUDED
@@ -0,0 +1,648 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__LISTFILTERPROXYMODEL_HPP__INCLUDED
+#define QTMWIDGETS__LISTFILTERPROXYMODEL_HPP__INCLUDED
+
+// QtMWidgets include.
+#include "listmodel.hpp"
+#include "private/listfilterproxymodel_p.hpp"
+
+// Qt include.
+#include <QThreadPool>
+#include <QPointer>
+#include <QMetaObject>
+
+// C++ include.
+#include <algorithm>
+
+
+namespace QtMWidgets {
+
+//
+// ListFilterProxyModel
+//
+
+/*!
+	ListFilterProxyModel shows rows of the source ListModel
+	accepted by the predicate.
+
+	Proxy rows are mapped to the source rows with the sorted vector
+	of source rows. Predicate is evaluated in parallel chunks on
+	worker threads on the snapshot of the source data, so it should
+	be thread-safe. Results of the stale queries are dropped. When
+	the new query refines the previous one (accepts subset of its
+	rows) only rows of the previous result are checked.
+
+	Changes of the result and of the source model are reported with
+	incremental rowsInserted(), rowsRemoved() and dataChanged(),
+	so views don't lay out all rows again. Too fragmented changes
+	are reported with modelReset().
+
+	Data may be changed with setData(), but rows should be inserted,
+	moved and removed in the source model.
+*/
+template< typename T >
+class ListFilterProxyModel
+	:	public ListModel< T >
+{
+public:
+	//! Predicate, returns true if the row should be shown.
+	typedef std::function< bool ( const T & ) > Predicate;
+
+	explicit ListFilterProxyModel( QObject * parent = 0 )
+		:	ListModel< T > ( parent )
+		,	m_source( 0 )
+		,	m_filtered( false )
+		,	m_jobRefines( false )
+	{
+	}
+
+	virtual ~ListFilterProxyModel()
+	{
+		cancelJob();
+
+		// Chunks hold pointer to this proxy.
+		m_pool.waitForDone();
+	}
+
+	//! \return Source model.
+	ListModel< T > * sourceModel() const
+	{
+		return m_source;
+	}
+
+	//! Set source model.
+	void setSourceModel( ListModel< T > * m )
+	{
+		if( m_source == m )
+			return;
+
+		if( m_source )
+			QObject::disconnect( m_source, 0, this, 0 );
+
+		m_source = m;
+
+		if( m_source )
+		{
+			QObject::connect( m_source, &AbstractListModel::dataChanged, this,
+				[this] ( int first, int last, AbstractListModel::ChangeHint hint )
+					{ sourceDataChanged( first, last, hint ); } );
+			QObject::connect( m_source, &AbstractListModel::rowsInserted, this,
+				[this] ( int first, int last ) { sourceRowsInserted( first, last ); } );
+			QObject::connect( m_source, &AbstractListModel::rowsRemoved, this,
+				[this] ( int first, int last ) { sourceRowsRemoved( first, last ); } );
+			QObject::connect( m_source, &AbstractListModel::rowsMoved, this,
+				[this] ( int start, int end, int destination )
+					{ sourceRowsMoved( start, end, destination ); } );
+			QObject::connect( m_source, &AbstractListModel::modelReset, this,
+				[this] () { sourceModelReset(); } );
+			QObject::connect( m_source, &QObject::destroyed, this,
+				[this] () { m_source = 0; sourceModelReset(); } );
+		}
+
+		sourceModelReset();
+	}
+
+	/*!
+		Set filter \a predicate.
+
+		Pass true in \a refines if the new predicate accepts only
+		rows accepted by the previous one, for example when the user
+		typed one more character, then only the rows of the previous
+		result will be checked.
+	*/
+	void setFilter( const Predicate & predicate, bool refines = false )
+	{
+		const bool canRefine = refines && m_predicate &&
+			( !m_job || m_jobRefines );
+
+		m_predicate = predicate;
+
+		if( !m_predicate )
+		{
+			clearFilter();
+
+			return;
+		}
+
+		startJob( canRefine );
+	}
+
+	//! Show all rows of the source model.
+	void clearFilter()
+	{
+		cancelJob();
+
+		m_predicate = Predicate();
+
+		if( m_filtered )
+		{
+			updateRows( allRows() );
+
+			m_filtered = false;
+			m_rows = QVector< int > ();
+		}
+	}
+
+	//! \return Is there not finished query?
+	bool isFiltering() const
+	{
+		return !m_job.isNull();
+	}
+
+	//! \return Source row of the given proxy \a row.
+	int mapToSource( int row ) const
+	{
+		if( row < 0 || row >= rowCount() )
+			return -1;
+
+		return ( m_filtered ? m_rows.at( row ) : row );
+	}
+
+	//! \return Proxy row of the given \a sourceRow or -1 if it's filtered out.
+	int mapFromSource( int sourceRow ) const
+	{
+		if( !m_source || sourceRow < 0 || sourceRow >= m_source->rowCount() )
+			return -1;
+
+		if( !m_filtered )
+			return sourceRow;
+
+		const int pos = lowerBound( sourceRow );
+
+		return ( pos < m_rows.size() && m_rows.at( pos ) == sourceRow ? pos : -1 );
+	}
+
+	const T & data( int row ) const override
+	{
+		return m_source->data( mapToSource( row ) );
+	}
+
+	QList< T > dataSnapshot() const override
+	{
+		QList< T > result;
+
+		for( int i = 0, last = rowCount(); i < last; ++i )
+			result.append( data( i ) );
+
+		return result;
+	}
+
+	int rowCount() const override
+	{
+		if( !m_source )
+			return 0;
+
+		return ( m_filtered ? m_rows.size() : m_source->rowCount() );
+	}
+
+	bool setData( int row, const T & value,
+		AbstractListModel::ChangeHint hint = AbstractListModel::LayoutChange ) override
+	{
+		const int sourceRow = mapToSource( row );
+
+		if( sourceRow < 0 )
+			return false;
+
+		return m_source->setData( sourceRow, value, hint );
+	}
+
+	using ListModel< T >::insertRow;
+
+	bool insertRow( int row, const T & value ) override
+	{
+		Q_UNUSED( row )
+		Q_UNUSED( value )
+
+		qWarning( "ListFilterProxyModel::insertRow: insert rows into the source model." );
+
+		return false;
+	}
+
+	bool insertRows( int row, int count ) override
+	{
+		Q_UNUSED( row )
+		Q_UNUSED( count )
+
+		qWarning( "ListFilterProxyModel::insertRows: insert rows into the source model." );
+
+		return false;
+	}
+
+	bool moveRows( int sourceRow, int count, int destinationRow ) override
+	{
+		Q_UNUSED( sourceRow )
+		Q_UNUSED( count )
+		Q_UNUSED( destinationRow )
+
+		qWarning( "ListFilterProxyModel::moveRows: move rows in the source model." );
+
+		return false;
+	}
+
+	bool removeRows( int row, int count ) override
+	{
+		Q_UNUSED( row )
+		Q_UNUSED( count )
+
+		qWarning( "ListFilterProxyModel::removeRows: remove rows from the source model." );
+
+		return false;
+	}
+
+	void reset() override
+	{
+		qWarning( "ListFilterProxyModel::reset: reset the source model." );
+	}
+
+	MemoryUsage memoryUsage() const override
+	{
+		MemoryUsage u;
+		u.add( MemoryUsage::Data, sizeof( ListFilterProxyModel< T > ) +
+			estimatedBytes( m_rows ) );
+
+		return u;
+	}
+
+private:
+	//! \return Position of the first mapped row not less than \a sourceRow.
+	int lowerBound( int sourceRow ) const
+	{
+		return static_cast< int > ( std::lower_bound( m_rows.cbegin(), m_rows.cend(),
+			sourceRow ) - m_rows.cbegin() );
+	}
+
+	//! \return All rows of the source model.
+	QVector< int > allRows() const
+	{
+		QVector< int > rows;
+
+		const int count = ( m_source ? m_source->rowCount() : 0 );
+
+		rows.reserve( count );
+
+		for( int i = 0; i < count; ++i )
+			rows.append( i );
+
+		return rows;
+	}
+
+	//! Cancel not finished query.
+	void cancelJob()
+	{
+		if( m_job )
+		{
+			m_job->cancelled.storeRelaxed( 1 );
+			m_job.reset();
+		}
+	}
+
+	//! Start query with the current predicate.
+	void startJob( bool refines )
+	{
+		cancelJob();
+
+		if( !m_source )
+			return;
+
+		if( !m_filtered )
+		{
+			// Identity mapping is stored explicitly while filtering.
+			m_rows = allRows();
+			m_filtered = true;
+		}
+
+		QSharedPointer< ListFilterJob< T > > job( new ListFilterJob< T > );
+		job->data = m_source->dataSnapshot();
+		job->predicate = m_predicate;
+		job->all = !refines;
+		job->refines = refines;
+
+		if( refines )
+			job->candidates = m_rows;
+
+		const int count = ( job->all ? job->data.size() : job->candidates.size() );
+
+		if( count < c_minParallelFilterRows )
+		{
+			QVector< int > rows;
+
+			for( int i = 0; i < count; ++i )
+			{
+				const int row = ( job->all ? i : job->candidates.at( i ) );
+
+				if( m_predicate( job->data.at( row ) ) )
+					rows.append( row );
+			}
+
+			updateRows( rows );
+
+			return;
+		}
+
+		const int threads = qMax( 1, m_pool.maxThreadCount() );
+		const int chunkRows = qMax( c_minFilterChunkRows,
+			( count + threads * 4 - 1 ) / ( threads * 4 ) );
+		const int chunks = ( count + chunkRows - 1 ) / chunkRows;
+
+		job->results.resize( chunks );
+		job->pending.storeRelaxed( chunks );
+
+		m_job = job;
+		m_jobRefines = refines;
+
+		QVector< int > * results = job->results.data();
+		ListFilterProxyModel< T > * proxy = this;
+
+		const std::function< void () > done = [proxy, job] ()
+			{
+				QMetaObject::invokeMethod( proxy,
+					[proxy, job] () { proxy->finishJob( job ); },
+					Qt::QueuedConnection );
+			};
+
+		for( int i = 0; i < chunks; ++i )
+			m_pool.start( new ListFilterChunk< T > ( job, results + i,
+				i * chunkRows, qMin( count, ( i + 1 ) * chunkRows ), done ) );
+	}
+
+	//! Apply results of the query.
+	void finishJob( const QSharedPointer< ListFilterJob< T > > & job )
+	{
+		if( job != m_job )
+			return;
+
+		m_job.reset();
+
+		QVector< int > rows;
+
+		foreach( const QVector< int > & r, job->results )
+			rows.append( r );
+
+		updateRows( rows );
+	}
+
+	//! Replace mapping with the given sorted \a rows with incremental signals.
+	void updateRows( const QVector< int > & rows )
+	{
+		if( !m_filtered )
+		{
+			m_rows = allRows();
+			m_filtered = true;
+		}
+
+		// Runs of removed proxy rows.
+		QVector< QPair< int, int > > removed;
+		// Runs of inserted rows in positions of the new mapping.
+		QVector< QPair< int, int > > inserted;
+
+		for( int i = 0, j = 0; i < m_rows.size() || j < rows.size(); )
+		{
+			if( j == rows.size() || ( i < m_rows.size() && m_rows.at( i ) < rows.at( j ) ) )
+			{
+				if( !removed.isEmpty() && removed.last().second == i - 1 )
+					removed.last().second = i;
+				else
+					removed.append( qMakePair( i, i ) );
+
+				++i;
+			}
+			else if( i == m_rows.size() || rows.at( j ) < m_rows.at( i ) )
+			{
+				if( !inserted.isEmpty() && inserted.last().second == j - 1 )
+					inserted.last().second = j;
+				else
+					inserted.append( qMakePair( j, j ) );
+
+				++j;
+			}
+			else
+			{
+				++i;
+				++j;
+			}
+		}
+
+		if( removed.size() + inserted.size() > c_maxIncrementalFilterRuns )
+		{
+			m_rows = rows;
+
+			emit this->modelReset();
+
+			return;
+		}
+
+		for( int k = removed.size() - 1; k >= 0; --k )
+		{
+			const QPair< int, int > & r = removed.at( k );
+
+			m_rows.remove( r.first, r.second - r.first + 1 );
+
+			emit this->rowsRemoved( r.first, r.second );
+		}
+
+		for( int k = 0; k < inserted.size(); ++k )
+		{
+			const QPair< int, int > & r = inserted.at( k );
+
+			m_rows.insert( r.first, r.second - r.first + 1, 0 );
+
+			for( int i = r.first; i <= r.second; ++i )
+				m_rows[ i ] = rows.at( i );
+
+			emit this->rowsInserted( r.first, r.second );
+		}
+	}
+
+	//! Start the query again if source changed while it was running.
+	void restartJob()
+	{
+		if( m_job )
+			startJob( false );
+	}
+
+	void sourceDataChanged( int first, int last, AbstractListModel::ChangeHint hint )
+	{
+		if( !m_filtered )
+		{
+			emit this->dataChanged( first, last, hint );
+
+			return;
+		}
+
+		if( !m_predicate )
+			return;
+
+		for( int row = first; row <= last; ++row )
+		{
+			const int pos = lowerBound( row );
+			const bool mapped = ( pos < m_rows.size() && m_rows.at( pos ) == row );
+			const bool accepted = m_predicate( m_source->data( row ) );
+
+			if( mapped && accepted )
+				emit this->dataChanged( pos, pos, hint );
+			else if( mapped )
+			{
+				m_rows.remove( pos );
+
+				emit this->rowsRemoved( pos, pos );
+			}
+			else if( accepted )
+			{
+				m_rows.insert( pos, row );
+
+				emit this->rowsInserted( pos, pos );
+			}
+		}
+
+		restartJob();
+	}
+
+	void sourceRowsInserted( int first, int last )
+	{
+		if( !m_filtered )
+		{
+			emit this->rowsInserted( first, last );
+
+			return;
+		}
+
+		const int count = last - first + 1;
+		const int pos = lowerBound( first );
+
+		for( int i = pos; i < m_rows.size(); ++i )
+			m_rows[ i ] += count;
+
+		insertAccepted( pos, first, last );
+
+		restartJob();
+	}
+
+	//! Check source rows and insert accepted ones at the \a pos position.
+	void insertAccepted( int pos, int first, int last )
+	{
+		QVector< int > accepted;
+
+		for( int row = first; row <= last; ++row )
+		{
+			if( !m_predicate || m_predicate( m_source->data( row ) ) )
+				accepted.append( row );
+		}
+
+		if( !accepted.isEmpty() )
+		{
+			m_rows.insert( pos, accepted.size(), 0 );
+
+			for( int i = 0; i < accepted.size(); ++i )
+				m_rows[ pos + i ] = accepted.at( i );
+
+			emit this->rowsInserted( pos, pos + accepted.size() - 1 );
+		}
+	}
+
+	void sourceRowsRemoved( int first, int last )
+	{
+		if( !m_filtered )
+		{
+			emit this->rowsRemoved( first, last );
+
+			return;
+		}
+
+		const int count = last - first + 1;
+		const int begin = lowerBound( first );
+		const int end = lowerBound( last + 1 );
+
+		for( int i = end; i < m_rows.size(); ++i )
+			m_rows[ i ] -= count;
+
+		if( end > begin )
+		{
+			m_rows.remove( begin, end - begin );
+
+			emit this->rowsRemoved( begin, end - 1 );
+		}
+
+		restartJob();
+	}
+
+	void sourceRowsMoved( int sourceStart, int sourceEnd, int destinationRow )
+	{
+		if( !m_filtered )
+		{
+			emit this->rowsMoved( sourceStart, sourceEnd, destinationRow );
+
+			return;
+		}
+
+		// Rows are moved inside this range, check them again.
+		const int first = qMin( sourceStart, destinationRow );
+		const int last = qMin( m_source->rowCount() - 1,
+			qMax( sourceEnd, destinationRow + sourceEnd - sourceStart ) );
+
+		if( last < first )
+			return;
+
+		const int begin = lowerBound( first );
+		const int end = lowerBound( last + 1 );
+
+		if( end > begin )
+		{
+			m_rows.remove( begin, end - begin );
+
+			emit this->rowsRemoved( begin, end - 1 );
+		}
+
+		insertAccepted( begin, first, last );
+
+		restartJob();
+	}
+
+	void sourceModelReset()
+	{
+		cancelJob();
+
+		if( m_filtered && m_predicate && m_source )
+		{
+			// Rows will be inserted when the query finishes.
+			m_rows.clear();
+
+			emit this->modelReset();
+
+			startJob( false );
+		}
+		else
+		{
+			m_filtered = false;
+			m_rows = QVector< int > ();
+
+			emit this->modelReset();
+		}
+	}
+
+private:
+	Q_DISABLE_COPY( ListFilterProxyModel )
+
+	//! Source model.
+	ListModel< T > * m_source;
+	//! Filter.
+	Predicate m_predicate;
+	//! Sorted source rows of the proxy rows, if filtered.
+	QVector< int > m_rows;
+	//! Is mapping stored in m_rows? Otherwise it's identity.
+	bool m_filtered;
+	//! Not finished query.
+	QSharedPointer< ListFilterJob< T > > m_job;
+	//! Does not finished query refine the previous one?
+	bool m_jobRefines;
+	//! Worker threads.
+	QThreadPool m_pool;
+}; // class ListFilterProxyModel
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__LISTFILTERPROXYMODEL_HPP__INCLUDED
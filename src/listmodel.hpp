@@ -47,8 +47,18 @@ public:
 		return d->data.at( row );
 	}
 
+	/*!
+		\return Copy of all data in the model. Data is implicitly
+		shared, so the copy is cheap and may be read from other threads
+		while the model changes.
+	*/
+	virtual QList< T > dataSnapshot() const
+	{
+		return d->data;
+	}
+
 	//! Insert new row at the given \a row position with \a value value.
-	bool insertRow( int row, const T & value )
+	virtual bool insertRow( int row, const T & value )
 	{
 		if( row > d->data.count() )
 			return false;
@@ -136,15 +146,21 @@ public:
 		return d->data.count();
 	}
 
-	//! Set data in \a row position to the \a value value.
-	virtual bool setData( int row, const T & value )
+	/*!
+		Set data in \a row position to the \a value value.
+
+		Pass PaintOnlyChange \a hint if the new value doesn't change
+		height of the row, then views just repaint the row.
+	*/
+	virtual bool setData( int row, const T & value,
+		ChangeHint hint = LayoutChange )
 	{
 		if( row >= d->data.count() )
 			return false;
 
 		d->data[ row ] = value;
 
-		emit dataChanged( row, row );
+		emit dataChanged( row, row, hint );
 
 		return true;
 	}
@@ -167,6 +183,15 @@ public:
 		emit modelReset();
 	}
 
+	MemoryUsage memoryUsage() const override
+	{
+		MemoryUsage u;
+		u.add( MemoryUsage::Data, sizeof( ListModel< T > ) +
+			sizeof( ListModelPrivate< T > ) + estimatedBytes( d->data ) );
+
+		return u;
+	}
+
 protected:
 	explicit ListModel( ListModelPrivate< T > * dd, QObject * parent = 0 )
 		:	AbstractListModel( parent )
@@ -0,0 +1,176 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "memoryusage.hpp"
+#include "abstractscrollarea.hpp"
+#include "picker.hpp"
+#include "datetimepicker.hpp"
+#include "multipicker.hpp"
+#include "tableview.hpp"
+
+// Qt include.
+#include <QWidget>
+#include <QAbstractItemModel>
+#include <QLocale>
+#include <QVariant>
+
+
+namespace QtMWidgets {
+
+// Estimated size of QWidgetPrivate and QObjectPrivate of the widget.
+static const qint64 c_widgetPrivateBytes = 512;
+
+// Estimated size of the item of the item model without its text.
+static const qint64 c_modelItemBytes = 96;
+
+
+//
+// MemoryUsage
+//
+
+MemoryUsage::MemoryUsage()
+{
+	for( int i = 0; i < 4; ++i )
+		m_bytes[ i ] = 0;
+}
+
+qint64
+MemoryUsage::bytes( Category c ) const
+{
+	return m_bytes[ c ];
+}
+
+void
+MemoryUsage::add( Category c, qint64 b )
+{
+	m_bytes[ c ] += b;
+}
+
+qint64
+MemoryUsage::total() const
+{
+	return m_bytes[ Data ] + m_bytes[ Caches ] +
+		m_bytes[ ChildWidgets ] + m_bytes[ Animations ];
+}
+
+MemoryUsage &
+MemoryUsage::operator += ( const MemoryUsage & other )
+{
+	for( int i = 0; i < 4; ++i )
+		m_bytes[ i ] += other.m_bytes[ i ];
+
+	return *this;
+}
+
+MemoryUsage
+MemoryUsage::ofWidget( const QWidget * w )
+{
+	if( !w )
+		return MemoryUsage();
+
+	if( const AbstractScrollArea * a = qobject_cast< const AbstractScrollArea* > ( w ) )
+		return a->memoryUsage();
+	else if( const Picker * p = qobject_cast< const Picker* > ( w ) )
+		return p->memoryUsage();
+	else if( const DateTimePicker * p = qobject_cast< const DateTimePicker* > ( w ) )
+		return p->memoryUsage();
+	else if( const MultiPicker * p = qobject_cast< const MultiPicker* > ( w ) )
+		return p->memoryUsage();
+	else if( const TableViewSection * s = qobject_cast< const TableViewSection* > ( w ) )
+		return s->memoryUsage();
+
+	MemoryUsage u;
+	u.add( Data, widgetBytes( sizeof( QWidget ) ) );
+
+	return u;
+}
+
+MemoryUsage
+MemoryUsage::ofTree( const QWidget * w )
+{
+	MemoryUsage u = ofWidget( w );
+
+	if( w )
+	{
+		foreach( const QWidget * child,
+			w->findChildren< QWidget* > ( QString(), Qt::FindDirectChildrenOnly ) )
+				u.add( ChildWidgets, ofTree( child ).total() );
+	}
+
+	return u;
+}
+
+static QString
+formatBytes( qint64 bytes )
+{
+	return QLocale::c().formattedDataSize( bytes, 1,
+		QLocale::DataSizeTraditionalFormat );
+}
+
+static void
+dumpTree( const QWidget * w, int level, QString & out )
+{
+	const MemoryUsage u = MemoryUsage::ofTree( w );
+
+	out.append( QString( level * 2, QLatin1Char( ' ' ) ) );
+	out.append( QLatin1String( w->metaObject()->className() ) );
+
+	if( !w->objectName().isEmpty() )
+		out.append( QStringLiteral( " \"%1\"" ).arg( w->objectName() ) );
+
+	out.append( QStringLiteral( ": %1 (data %2, caches %3, children %4, "
+			"animations %5)\n" )
+		.arg( formatBytes( u.total() ),
+			formatBytes( u.bytes( MemoryUsage::Data ) ),
+			formatBytes( u.bytes( MemoryUsage::Caches ) ),
+			formatBytes( u.bytes( MemoryUsage::ChildWidgets ) ),
+			formatBytes( u.bytes( MemoryUsage::Animations ) ) ) );
+
+	foreach( const QWidget * child,
+		w->findChildren< QWidget* > ( QString(), Qt::FindDirectChildrenOnly ) )
+			dumpTree( child, level + 1, out );
+}
+
+QString
+MemoryUsage::dump( const QWidget * w )
+{
+	QString out;
+
+	if( w )
+		dumpTree( w, 0, out );
+
+	return out;
+}
+
+
+//
+// estimatedBytes
+//
+
+qint64
+widgetBytes( size_t size )
+{
+	return static_cast< qint64 > ( size ) + c_widgetPrivateBytes;
+}
+
+qint64
+estimatedBytes( const QAbstractItemModel * model, int column )
+{
+	if( !model )
+		return 0;
+
+	const int rows = model->rowCount();
+
+	qint64 bytes = rows * c_modelItemBytes;
+
+	for( int i = 0; i < rows; ++i )
+		bytes += estimatedBytes( model->data( model->index( i, column ) ).toString() );
+
+	return bytes;
+}
+
+} /* namespace QtMWidgets */
@@ -0,0 +1,141 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__MEMORYUSAGE_HPP__INCLUDED
+#define QTMWIDGETS__MEMORYUSAGE_HPP__INCLUDED
+
+// Qt include.
+#include <QString>
+#include <QByteArray>
+#include <QList>
+#include <QImage>
+#include <QPixmap>
+
+QT_BEGIN_NAMESPACE
+class QWidget;
+class QAbstractItemModel;
+QT_END_NAMESPACE
+
+
+namespace QtMWidgets {
+
+//
+// MemoryUsage
+//
+
+/*!
+	MemoryUsage is an approximate amount of memory owned by the
+	widget or the model, broken down by categories.
+
+	Numbers are estimations based on sizes of the objects and
+	capacities of the containers, they are intended to find
+	screens that use too much memory, not for exact accounting.
+*/
+class MemoryUsage {
+public:
+	//! Category of the memory.
+	enum Category {
+		//! Data of the widget or the model.
+		Data = 0,
+		//! Caches, that may be dropped and computed again.
+		Caches = 1,
+		//! Child widgets.
+		ChildWidgets = 2,
+		//! Animations and timers.
+		Animations = 3
+	}; // enum Category
+
+	MemoryUsage();
+
+	//! \return Bytes in the given category.
+	qint64 bytes( Category c ) const;
+	//! Add \a b bytes to the given category.
+	void add( Category c, qint64 b );
+	//! \return Bytes in all categories.
+	qint64 total() const;
+
+	MemoryUsage & operator += ( const MemoryUsage & other );
+
+	/*!
+		\return Memory owned by the given widget itself, without
+		child widgets. Widgets of QtMWidgets report their data,
+		for other widgets only the size of the object is estimated.
+	*/
+	static MemoryUsage ofWidget( const QWidget * w );
+
+	//! \return Memory owned by the given widget and all child widgets.
+	static MemoryUsage ofTree( const QWidget * w );
+
+	/*!
+		\return Human readable tree of the given widget and its
+		child widgets with memory used by each of them. Usually
+		called for the top-level window.
+	*/
+	static QString dump( const QWidget * w );
+
+private:
+	qint64 m_bytes[ 4 ];
+}; // class MemoryUsage
+
+
+//
+// estimatedBytes
+//
+
+//! \return Estimated bytes owned by the value.
+template< typename T >
+inline qint64 estimatedBytes( const T & )
+{
+	return sizeof( T );
+}
+
+//! \return Estimated bytes owned by the string.
+inline qint64 estimatedBytes( const QString & s )
+{
+	return sizeof( QString ) + s.capacity() * sizeof( QChar );
+}
+
+//! \return Estimated bytes owned by the byte array.
+inline qint64 estimatedBytes( const QByteArray & a )
+{
+	return sizeof( QByteArray ) + a.capacity();
+}
+
+//! \return Estimated bytes owned by the image.
+inline qint64 estimatedBytes( const QImage & i )
+{
+	return sizeof( QImage ) + i.sizeInBytes();
+}
+
+//! \return Estimated bytes owned by the pixmap.
+inline qint64 estimatedBytes( const QPixmap & p )
+{
+	return sizeof( QPixmap ) +
+		(qint64) p.width() * p.height() * p.depth() / 8;
+}
+
+//! \return Estimated bytes owned by the list and its items.
+template< typename T >
+inline qint64 estimatedBytes( const QList< T > & l )
+{
+	qint64 bytes = sizeof( QList< T > ) +
+		( l.capacity() - l.size() ) * sizeof( T );
+
+	foreach( const T & v, l )
+		bytes += estimatedBytes( v );
+
+	return bytes;
+}
+
+//! \return Estimated bytes owned by the items of the given model column.
+qint64 estimatedBytes( const QAbstractItemModel * model, int column );
+
+//! \return Estimated bytes of the widget object of the given size.
+qint64 widgetBytes( size_t size );
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__MEMORYUSAGE_HPP__INCLUDED
@@ -0,0 +1,484 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "multipicker.hpp"
+#include "private/pickersections.hpp"
+#include "private/drawing.hpp"
+#include "scroller.hpp"
+
+// Qt include.
+#include <QEvent>
+#include <QMouseEvent>
+#include <QWheelEvent>
+#include <QPainter>
+#include <QStyleOption>
+#include <QPen>
+#include <QVariantAnimation>
+
+
+namespace QtMWidgets {
+
+//
+// MultiPickerPrivate
+//
+
+class MultiPickerPrivate
+	:	public PickerSections
+{
+public:
+	MultiPickerPrivate( MultiPicker * parent )
+		:	PickerSections( parent, columns )
+		,	q( parent )
+		,	leftMouseButtonPressed( false )
+		,	movableSectionIndex( -1 )
+		,	widthsDirty( true )
+		,	scroller( 0 )
+		,	scrolling( false )
+	{
+	}
+
+	void init();
+	bool isValidColumn( int column ) const;
+	void computeWidths( const QStyleOption & opt );
+	void startMoving( const QPointF & pos );
+	void finishMoving();
+	void releaseScrolling();
+
+	MultiPicker * q;
+	QVector< Section > columns;
+	QPoint mousePos;
+	bool leftMouseButtonPressed;
+	int movableSectionIndex;
+	bool widthsDirty;
+	Scroller * scroller;
+	bool scrolling;
+}; // class MultiPickerPrivate
+
+void
+MultiPickerPrivate::init()
+{
+	q->setSizePolicy( QSizePolicy( QSizePolicy::Fixed,
+		QSizePolicy::Fixed ) );
+
+	scroller = new Scroller( q, q );
+}
+
+bool
+MultiPickerPrivate::isValidColumn( int column ) const
+{
+	return ( column >= 0 && column < columns.size() );
+}
+
+void
+MultiPickerPrivate::computeWidths( const QStyleOption & opt )
+{
+	for( int i = 0; i < columns.size(); ++i )
+	{
+		int width = opt.fontMetrics.averageCharWidth() * 2;
+
+		for( const QString & text : columns.at( i ).values )
+			width = qMax( width, opt.fontMetrics.boundingRect( text ).width() );
+
+		width += opt.fontMetrics.averageCharWidth() / 3;
+
+		columns[ i ].sectionWidth = width + itemSideMargin * 2 + 6;
+	}
+
+	widthsDirty = false;
+}
+
+void
+MultiPickerPrivate::startMoving( const QPointF & pos )
+{
+	findMovableSection( pos );
+
+	movableSectionIndex = ( movableSection != -1 ?
+		columns.at( movableSection ).currentIndex : -1 );
+}
+
+void
+MultiPickerPrivate::finishMoving()
+{
+	normalizeOffsets();
+	clearOffset();
+
+	const int column = movableSection;
+
+	movableSection = -1;
+
+	if( column != -1 &&
+		columns.at( column ).currentIndex != movableSectionIndex )
+			emit q->currentIndexChanged( column,
+				columns.at( column ).currentIndex );
+
+	movableSectionIndex = -1;
+
+	q->update();
+}
+
+void
+MultiPickerPrivate::releaseScrolling()
+{
+	leftMouseButtonPressed = false;
+
+	finishMoving();
+}
+
+
+//
+// MultiPicker
+//
+
+MultiPicker::MultiPicker( QWidget * parent )
+	:	QWidget( parent )
+	,	d( new MultiPickerPrivate( this ) )
+{
+	d->init();
+
+	connect( d->scroller, &Scroller::aboutToStart,
+		this, &MultiPicker::_q_scrollAboutToStart );
+
+	connect( d->scroller, &Scroller::scroll,
+		this, &MultiPicker::_q_scroll );
+
+	connect( d->scroller, &Scroller::finished,
+		this, &MultiPicker::_q_scrollFinished );
+}
+
+MultiPicker::~MultiPicker()
+{
+}
+
+int
+MultiPicker::columnCount() const
+{
+	return d->columns.size();
+}
+
+int
+MultiPicker::addColumn( const QStringList & items )
+{
+	insertColumn( d->columns.size(), items );
+
+	return d->columns.size() - 1;
+}
+
+void
+MultiPicker::insertColumn( int column, const QStringList & items )
+{
+	if( column < 0 || column > d->columns.size() )
+		column = d->columns.size();
+
+	Section s;
+	s.values = items;
+	s.currentIndex = ( items.isEmpty() ? -1 : 0 );
+
+	d->columns.insert( column, s );
+
+	d->movableSection = -1;
+	d->widthsDirty = true;
+
+	updateGeometry();
+	update();
+}
+
+void
+MultiPicker::removeColumn( int column )
+{
+	if( !d->isValidColumn( column ) )
+	{
+		qWarning( "QtMWidgets::MultiPicker::removeColumn: Invalid column (%d)",
+			column );
+		return;
+	}
+
+	d->columns.remove( column );
+
+	d->movableSection = -1;
+	d->widthsDirty = true;
+
+	updateGeometry();
+	update();
+}
+
+void
+MultiPicker::clear()
+{
+	d->columns.clear();
+
+	d->movableSection = -1;
+	d->widthsDirty = true;
+
+	updateGeometry();
+	update();
+}
+
+QStringList
+MultiPicker::items( int column ) const
+{
+	if( d->isValidColumn( column ) )
+		return d->columns.at( column ).values;
+	else
+		return QStringList();
+}
+
+void
+MultiPicker::setItems( int column, const QStringList & items )
+{
+	if( !d->isValidColumn( column ) )
+	{
+		qWarning( "QtMWidgets::MultiPicker::setItems: Invalid column (%d)",
+			column );
+		return;
+	}
+
+	Section & s = d->columns[ column ];
+
+	const int prev = s.currentIndex;
+
+	s.values = items;
+	s.offset = 0;
+
+	if( items.isEmpty() )
+		s.currentIndex = -1;
+	else
+		s.currentIndex = qBound( 0, s.currentIndex, items.size() - 1 );
+
+	d->widthsDirty = true;
+
+	updateGeometry();
+	update();
+
+	if( s.currentIndex != prev )
+		emit currentIndexChanged( column, s.currentIndex );
+}
+
+int
+MultiPicker::count( int column ) const
+{
+	if( d->isValidColumn( column ) )
+		return d->columns.at( column ).values.size();
+	else
+		return 0;
+}
+
+QString
+MultiPicker::itemText( int column, int index ) const
+{
+	if( d->isValidColumn( column ) && index >= 0 &&
+		index < d->columns.at( column ).values.size() )
+			return d->columns.at( column ).values.at( index );
+	else
+		return QString();
+}
+
+int
+MultiPicker::currentIndex( int column ) const
+{
+	if( d->isValidColumn( column ) )
+		return d->columns.at( column ).currentIndex;
+	else
+		return -1;
+}
+
+QString
+MultiPicker::currentText( int column ) const
+{
+	return itemText( column, currentIndex( column ) );
+}
+
+Scroller *
+MultiPicker::scroller() const
+{
+	return d->scroller;
+}
+
+MemoryUsage
+MultiPicker::memoryUsage() const
+{
+	MemoryUsage u;
+	u.add( MemoryUsage::Data, widgetBytes( sizeof( MultiPicker ) ) +
+		sizeof( MultiPickerPrivate ) - sizeof( PickerSectionsStyleTokens ) );
+	u.add( MemoryUsage::Caches, sizeof( PickerSectionsStyleTokens ) );
+	u.add( MemoryUsage::Animations,
+		sizeof( Scroller ) + sizeof( QVariantAnimation ) );
+
+	foreach( const Section & s, d->columns )
+		u.add( MemoryUsage::Data, estimatedBytes( s.values ) );
+
+	return u;
+}
+
+QSize
+MultiPicker::sizeHint() const
+{
+	QStyleOption opt;
+	opt.initFrom( this );
+
+	d->computeItemsGeometry( opt );
+	d->computeWidths( opt );
+
+	return QSize( d->sectionX( d->columns.size() ), d->widgetHeight );
+}
+
+void
+MultiPicker::setCurrentIndex( int column, int index )
+{
+	if( !d->isValidColumn( column ) ||
+		index < 0 || index >= d->columns.at( column ).values.size() )
+	{
+		qWarning( "QtMWidgets::MultiPicker::setCurrentIndex: "
+			"Invalid column (%d) or index (%d)", column, index );
+		return;
+	}
+
+	Section & s = d->columns[ column ];
+
+	if( s.currentIndex != index )
+	{
+		s.currentIndex = index;
+		s.offset = 0;
+
+		update();
+
+		emit currentIndexChanged( column, index );
+	}
+}
+
+void
+MultiPicker::wheelEvent( QWheelEvent * event )
+{
+	QPoint numDegrees = event->angleDelta();
+
+	if( !numDegrees.isNull() )
+	{
+		d->startMoving( event->position() );
+
+		if( numDegrees.y() > 0 )
+			d->updateOffset( d->itemHeight + d->itemTopMargin );
+		else if( numDegrees.y() < 0 )
+			d->updateOffset( -( d->itemHeight + d->itemTopMargin ) );
+
+		d->finishMoving();
+	}
+
+	event->accept();
+}
+
+void
+MultiPicker::mousePressEvent( QMouseEvent * event )
+{
+	if( event->button() == Qt::LeftButton )
+	{
+		d->scrolling = false;
+		d->mousePos = event->pos();
+		d->leftMouseButtonPressed = true;
+		d->startMoving( event->pos() );
+
+		event->accept();
+	}
+	else
+		event->ignore();
+}
+
+void
+MultiPicker::mouseMoveEvent( QMouseEvent * event )
+{
+	if( d->leftMouseButtonPressed )
+	{
+		const int delta = event->pos().y() - d->mousePos.y();
+		d->updateOffset( delta );
+		d->mousePos = event->pos();
+		update();
+
+		event->accept();
+	}
+	else
+		event->ignore();
+}
+
+void
+MultiPicker::mouseReleaseEvent( QMouseEvent * event )
+{
+	if( event->button() == Qt::LeftButton )
+	{
+		if( d->leftMouseButtonPressed && !d->scrolling )
+			d->releaseScrolling();
+
+		event->accept();
+	}
+	else
+		event->ignore();
+}
+
+void
+MultiPicker::paintEvent( QPaintEvent * )
+{
+	const PickerSectionsStyleTokens & t = d->styleTokens();
+	const QStyleOption & opt = t.option;
+
+	d->computeItemsGeometry( opt );
+
+	if( d->widthsDirty )
+		d->computeWidths( opt );
+
+	d->normalizeOffsets();
+
+	QPainter p( this );
+
+	drawCylinder( &p, QRect( 0, 0, d->sectionX( d->columns.size() ),
+		d->widgetHeight ), t.cylinder );
+
+	p.setPen( t.baseColor );
+
+	for( int i = 1; i < d->columns.size(); ++i )
+	{
+		const int x = d->sectionX( i );
+
+		p.drawLine( x, 0, x, d->widgetHeight );
+	}
+
+	for( int i = 0; i < d->columns.size(); ++i )
+		d->drawSectionItems( i, &p );
+
+	d->drawWindow( &p, opt );
+}
+
+void
+MultiPicker::_q_scroll( int dx, int dy )
+{
+	Q_UNUSED( dx )
+
+	d->updateOffset( dy );
+
+	update();
+}
+
+void
+MultiPicker::_q_scrollAboutToStart()
+{
+	d->scrolling = true;
+}
+
+void
+MultiPicker::_q_scrollFinished()
+{
+	d->scrolling = false;
+
+	d->releaseScrolling();
+}
+
+void
+MultiPicker::changeEvent( QEvent * event )
+{
+	if( StyleTokens::isInvalidatedBy( event ) )
+		d->tokens.invalidate();
+
+	QWidget::changeEvent( event );
+}
+
+} /* namespace QtMWidgets */
@@ -0,0 +1,141 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__MULTIPICKER_HPP__INCLUDED
+#define QTMWIDGETS__MULTIPICKER_HPP__INCLUDED
+
+// Qt include.
+#include <QWidget>
+#include <QScopedPointer>
+#include <QStringList>
+
+// QtMWidgets include.
+#include "memoryusage.hpp"
+
+
+namespace QtMWidgets {
+
+class Scroller;
+
+
+//
+// MultiPicker
+//
+
+class MultiPickerPrivate;
+
+/*!
+	MultiPicker is a set of cylinders (columns) with strings shown side by
+	side in one widget, where in each column one string can be selected.
+	It's useful for selectors like value + unit + precision.
+
+	Unlike a row of Picker widgets MultiPicker paints all columns in
+	one pass on one cylinder background and has only one Scroller, that
+	scrolls the column under the finger.
+*/
+class MultiPicker
+	:	public QWidget
+{
+	Q_OBJECT
+
+	/*!
+		\property columnCount
+
+		\brief the number of columns in the picker
+
+		By default this property has a value of 0.
+	*/
+	Q_PROPERTY( int columnCount READ columnCount )
+
+signals:
+	/*!
+		This signal is sent whenever the current index of the \a column
+		changes either through user interaction or programmatically.
+		New \a index is passed.
+	*/
+	void currentIndexChanged( int column, int index );
+
+public:
+	explicit MultiPicker( QWidget * parent = 0 );
+	virtual ~MultiPicker();
+
+	//! \return Count of columns.
+	int columnCount() const;
+
+	/*!
+		Add column with the given \a items to the end.
+
+		\return Index of the new column.
+	*/
+	int addColumn( const QStringList & items );
+	/*!
+		Insert column with the given \a items at the given \a column
+		position. If \a column is out of range column will be added
+		to the end.
+	*/
+	void insertColumn( int column, const QStringList & items );
+	//! Remove the given \a column.
+	void removeColumn( int column );
+	//! Remove all columns.
+	void clear();
+
+	//! \return Items of the given \a column.
+	QStringList items( int column ) const;
+	/*!
+		Replace items of the given \a column. Current index is preserved
+		if possible.
+	*/
+	void setItems( int column, const QStringList & items );
+
+	//! \return Count of items in the given \a column.
+	int count( int column ) const;
+	//! \return Text of the item \a index in the given \a column.
+	QString itemText( int column, int index ) const;
+
+	/*!
+		\return Current index in the given \a column, or -1 if column
+		is empty or doesn't exist.
+	*/
+	int currentIndex( int column ) const;
+	//! \return Current text in the given \a column.
+	QString currentText( int column ) const;
+
+	//! \return Scroller interface.
+	Scroller * scroller() const;
+
+	//! \return Approximate memory owned by the picker.
+	MemoryUsage memoryUsage() const;
+
+	QSize sizeHint() const override;
+
+public slots:
+	//! Set current \a index in the given \a column.
+	void setCurrentIndex( int column, int index );
+
+protected:
+	void wheelEvent( QWheelEvent * event ) override;
+	void mousePressEvent( QMouseEvent * event ) override;
+	void mouseMoveEvent( QMouseEvent * event ) override;
+	void mouseReleaseEvent( QMouseEvent * event ) override;
+	void paintEvent( QPaintEvent * event ) override;
+	void changeEvent( QEvent * event ) override;
+
+private slots:
+	void _q_scroll( int dx, int dy );
+	void _q_scrollAboutToStart();
+	void _q_scrollFinished();
+
+private:
+	friend class MultiPickerPrivate;
+
+	Q_DISABLE_COPY( MultiPicker )
+
+	QScopedPointer< MultiPickerPrivate > d;
+}; // class MultiPicker
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__MULTIPICKER_HPP__INCLUDED
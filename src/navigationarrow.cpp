@@ -9,6 +9,7 @@
 #include "fingergeometry.hpp"
 #include "private/drawing.hpp"
 #include "color.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QPainter>
@@ -140,7 +141,7 @@ void
 NavigationArrow::paintEvent( QPaintEvent * )
 {
 	QPainter p( this );
-	p.setRenderHint( QPainter::Antialiasing );
+	p.setRenderHint( QPainter::Antialiasing, RenderingQuality::antialiasing() );
 
 	const QRect r = rect();
 
@@ -10,6 +10,7 @@
 #include "private/drawing.hpp"
 #include "color.hpp"
 #include "private/utils.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QStyleOption>
@@ -175,7 +176,7 @@ void
 NavigationButton::paintEvent( QPaintEvent * )
 {
 	QPainter p( this );
-	p.setRenderHint( QPainter::Antialiasing );
+	p.setRenderHint( QPainter::Antialiasing, RenderingQuality::antialiasing() );
 
 	const QRect r = rect();
 	QRect arrowRect;
@@ -8,6 +8,7 @@
 #include "pagecontrol.hpp"
 #include "fingergeometry.hpp"
 #include "color.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QStyleOption>
@@ -304,7 +305,7 @@ void
 PageControl::paintEvent( QPaintEvent * )
 {
 	QPainter p( this );
-	p.setRenderHint( QPainter::Antialiasing );
+	p.setRenderHint( QPainter::Antialiasing, RenderingQuality::antialiasing() );
 	p.setPen( d->pageIndicatorColor );
 
 	for( int i = 0; i < d->count; ++i )
@@ -11,9 +11,14 @@
 #include "scroller.hpp"
 #include "fingergeometry.hpp"
 #include "private/utils.hpp"
+#include "private/idlescheduler.hpp"
+#include "private/styletokens.hpp"
+#include "private/listaccessible.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QStandardItemModel>
+#include <QAbstractListModel>
 #include <QEvent>
 #include <QMouseEvent>
 #include <QPainter>
@@ -21,14 +26,192 @@
 #include <QFontMetrics>
 #include <QBrush>
 #include <QPen>
+#include <QVariantAnimation>
 
 #ifndef QT_NO_ACCESSIBILITY
 #include <QAccessible>
 #endif
 
+// C++ include.
+#include <cmath>
+
 
 namespace QtMWidgets {
 
+//! Ranges with more rows are measured by the sampled values.
+static const int c_maxMeasuredRangeRows = 1000;
+//! Count of the values sampled from the large range.
+static const int c_rangeSamples = 100;
+
+
+//
+// PickerRangeModel
+//
+
+//! Model of the picker in the range mode. Items are computed on demand.
+class PickerRangeModel
+	:	public QAbstractListModel
+{
+public:
+	PickerRangeModel( qreal minimum, qreal maximum, qreal step,
+		const Picker::RangeFormatter & formatter, QObject * parent )
+		:	QAbstractListModel( parent )
+		,	m_minimum( minimum )
+		,	m_step( step )
+		,	m_count( rowsCount( minimum, maximum, step ) )
+		,	m_decimals( decimalsCount( step ) )
+		,	m_formatter( formatter )
+	{
+	}
+
+	int rowCount( const QModelIndex & parent = QModelIndex() ) const override
+	{
+		return ( parent.isValid() ? 0 : m_count );
+	}
+
+	QVariant data( const QModelIndex & index,
+		int role = Qt::DisplayRole ) const override
+	{
+		if( !index.isValid() || index.row() >= m_count )
+			return QVariant();
+
+		switch( role )
+		{
+			case Qt::DisplayRole :
+				return text( index.row() );
+
+			case Qt::UserRole :
+				return value( index.row() );
+
+			default :
+				return QVariant();
+		}
+	}
+
+	qreal value( int row ) const
+	{
+		return m_minimum + m_step * row;
+	}
+
+	QString text( int row ) const
+	{
+		if( m_formatter )
+			return m_formatter( value( row ) );
+		else
+			return QString::number( value( row ), 'f', m_decimals );
+	}
+
+	int row( qreal v ) const
+	{
+		const qreal r = std::round( ( v - m_minimum ) / m_step );
+
+		return static_cast< int > ( qBound( 0.0, r,
+			static_cast< qreal > ( m_count - 1 ) ) );
+	}
+
+	void setFormatter( const Picker::RangeFormatter & f )
+	{
+		m_formatter = f;
+
+		if( m_count > 0 )
+			emit dataChanged( index( 0 ), index( m_count - 1 ) );
+	}
+
+private:
+	static int rowsCount( qreal minimum, qreal maximum, qreal step )
+	{
+		const qreal n = std::floor( ( maximum - minimum ) / step + 1e-9 );
+
+		return static_cast< int > ( qMin( n,
+			static_cast< qreal > ( INT_MAX - 1 ) ) ) + 1;
+	}
+
+	static int decimalsCount( qreal step )
+	{
+		int decimals = 0;
+
+		while( decimals < 6 &&
+			qAbs( step - std::round( step ) ) > 1e-9 * qMax( 1.0, qAbs( step ) ) )
+		{
+			step *= 10.0;
+			++decimals;
+		}
+
+		return decimals;
+	}
+
+private:
+	qreal m_minimum;
+	qreal m_step;
+	int m_count;
+	int m_decimals;
+	Picker::RangeFormatter m_formatter;
+}; // class PickerRangeModel
+
+
+class PickerPrivate;
+
+//
+// PickerWidthJob
+//
+
+//! Measures width of the items of the picker in slices.
+class PickerWidthJob
+	:	public IdleJob
+{
+public:
+	explicit PickerWidthJob( PickerPrivate * dd )
+		:	IdleJob( "Picker::computeStringWidth" )
+		,	d( dd )
+		,	row( 0 )
+		,	width( 0 )
+	{
+	}
+
+	//! Start measuring from the first item.
+	void restart( const QFont & f );
+
+	//! Measured font.
+	QFont font;
+
+protected:
+	bool run( const QDeadlineTimer & sliceEnd ) override;
+	void finished() override;
+
+private:
+	PickerPrivate * d;
+	int row;
+	int width;
+}; // class PickerWidthJob
+
+
+//
+// PickerStyleTokens
+//
+
+class PickerStyleTokens
+	:	public StyleTokens
+{
+public:
+	//! Resolve colors and brushes.
+	void resolve( const QWidget * widget );
+
+	QColor textColor;
+	QColor disabledTextColor;
+	CylinderBrushes cylinder;
+}; // class PickerStyleTokens
+
+void
+PickerStyleTokens::resolve( const QWidget * widget )
+{
+	StyleTokens::resolve( widget );
+
+	textColor = option.palette.color( QPalette::WindowText );
+	disabledTextColor = lighterColor( textColor, 75 );
+	cylinder = CylinderBrushes( option.palette.color( QPalette::Dark ) );
+}
+
+
 //
 // PickerPrivate
 //
@@ -55,6 +238,9 @@ public:
 		,	wasPainted( false )
 		,	mouseMoveDelta( 0 )
 		,	scroller( 0 )
+		,	rangeModel( 0 )
+		,	stringWidthValid( false )
+		,	widthJob( this )
 	{}
 
 	void init();
@@ -63,9 +249,15 @@ public:
 	QSize minimumSizeHint( const QStyleOption & opt );
 	QSize sizeHint( const QStyleOption & opt );
 	void computeStringWidth();
+	void invalidateStringWidth();
 	void drawItem( QPainter * p, const QStyleOption & opt, int offset,
 		const QModelIndex & index );
 	void normalizeOffset();
+	/*!
+		Calculate normalized \a top row and draw \a offset from the
+		given ones without changing scroll state.
+	*/
+	void normalizedOffset( int * top, int * offset ) const;
 	void makePrevIndex( QPersistentModelIndex & index );
 	void makeNextIndex( QPersistentModelIndex & index );
 	QString makeString( const QString & text, const QRect & r, int flags,
@@ -77,6 +269,14 @@ public:
 	bool isIndexesVisible( const QModelIndex & topLeft,
 		const QModelIndex & bottomRight );
 	bool isRowsVisible( int start, int end );
+	/*!
+		\return Rows shown in the picker from the top, \a offset is set
+		to the top of the first row. Scroll state is not changed.
+	*/
+	QVector< int > visibleRows( int * offset ) const;
+	bool isRangeMode() const;
+	//! \return Resolved style tokens.
+	const PickerStyleTokens & styleTokens();
 
 	Picker * q;
 	QAbstractItemModel * model;
@@ -102,8 +302,149 @@ public:
 	int mouseMoveDelta;
 	QColor highlightColor;
 	Scroller * scroller;
+	PickerRangeModel * rangeModel;
+	Picker::RangeFormatter rangeFormatter;
+	bool stringWidthValid;
+	PickerWidthJob widthJob;
+	PickerStyleTokens tokens;
 }; // class PickerPrivate
 
+
+//
+// PickerWidthJob
+//
+
+void
+PickerWidthJob::restart( const QFont & f )
+{
+	font = f;
+	row = 0;
+	width = 25;
+}
+
+bool
+PickerWidthJob::run( const QDeadlineTimer & sliceEnd )
+{
+	const int rowCount = d->q->count();
+	const QFontMetrics fm( font );
+
+	while( row < rowCount )
+	{
+		width = qMax( width,
+			fm.boundingRect( d->q->itemText( row ) ).width() );
+
+		++row;
+
+		if( sliceEnd.hasExpired() )
+			break;
+	}
+
+	return ( row >= rowCount );
+}
+
+void
+PickerWidthJob::finished()
+{
+	d->stringWidthValid = true;
+
+	if( d->maxStringWidth != width )
+	{
+		d->maxStringWidth = width;
+
+		// Size hint returned while measuring is stale.
+		d->q->updateGeometry();
+	}
+}
+
+#ifndef QT_NO_ACCESSIBILITY
+
+//
+// PickerAccessible
+//
+
+//! Accessible interface of the picker, rows are created lazily.
+class PickerAccessible
+	:	public ListAccessible
+{
+public:
+	explicit PickerAccessible( Picker * picker )
+		:	ListAccessible( picker )
+	{
+	}
+
+	int rowCount() const override
+	{
+		return picker()->count();
+	}
+
+	QVector< int > visibleRows() const override
+	{
+		int offset = 0;
+
+		return picker()->d->visibleRows( &offset );
+	}
+
+	QRect rowRect( int row ) const override
+	{
+		const PickerPrivate * d = picker()->d.data();
+
+		int offset = 0;
+
+		const int i = d->visibleRows( &offset ).indexOf( row );
+
+		if( i < 0 )
+			return QRect();
+
+		return QRect( d->itemSideMargin,
+			offset + i * ( d->itemTopMargin + d->stringHeight ),
+			picker()->width() - d->itemSideMargin * 2, d->stringHeight );
+	}
+
+	QString rowText( int row ) const override
+	{
+		return picker()->itemText( row );
+	}
+
+	int currentRow() const override
+	{
+		return picker()->currentIndex();
+	}
+
+	bool setCurrentRow( int row ) override
+	{
+		picker()->setCurrentIndex( row );
+
+		return ( picker()->currentIndex() == row );
+	}
+
+	QString text( QAccessible::Text t ) const override
+	{
+		if( t == QAccessible::Value )
+			return picker()->currentText();
+
+		return ListAccessible::text( t );
+	}
+
+private:
+	Picker * picker() const
+	{
+		return static_cast< Picker* > ( widget() );
+	}
+}; // class PickerAccessible
+
+static QAccessibleInterface *
+pickerAccessibleFactory( const QString & className, QObject * object )
+{
+	if( className == QLatin1String( "QtMWidgets::Picker" ) &&
+		object && object->isWidgetType() )
+			return new PickerAccessible( static_cast< Picker* > ( object ) );
+
+	return 0;
+}
+
+#endif // QT_NO_ACCESSIBILITY
+
+
 void
 PickerPrivate::init()
 {
@@ -114,6 +455,12 @@ PickerPrivate::init()
 
 	scroller = new Scroller( q, q );
 
+#ifndef QT_NO_ACCESSIBILITY
+	static const bool factoryInstalled = ( QAccessible::installFactory(
+		pickerAccessibleFactory ), true );
+	Q_UNUSED( factoryInstalled )
+#endif
+
 	QStyleOption opt;
 	opt.initFrom( q );
 
@@ -188,22 +535,72 @@ PickerPrivate::sizeHint( const QStyleOption & opt )
 void
 PickerPrivate::computeStringWidth()
 {
-	maxStringWidth = 25;
+	if( stringWidthValid && widthJob.font == q->font() )
+		return;
+
+	if( widthJob.isPending() && widthJob.font == q->font() )
+		return;
 
 	const int rowCount = q->count();
 
-	if( rowCount > 0 )
+	// Small range is measured as the usual model. In the large range
+	// only sampled values are formatted, their digits are replaced with
+	// the widest one, so proportional digits never overflow.
+	if( isRangeMode() && rowCount > c_maxMeasuredRangeRows )
 	{
 		const QFontMetrics & fm = q->fontMetrics();
 
-		for( int i = 0; i < rowCount; ++i )
+		QChar widestDigit = QLatin1Char( '0' );
+
+		for( char c = '1'; c <= '9'; ++c )
+		{
+			if( fm.horizontalAdvance( QLatin1Char( c ) ) >
+				fm.horizontalAdvance( widestDigit ) )
+					widestDigit = QLatin1Char( c );
+		}
+
+		int width = 25;
+
+		for( int i = 0; i < c_rangeSamples; ++i )
 		{
-			const int width = fm.boundingRect( q->itemText( i ) ).width();
+			const int row = static_cast< int > ( static_cast< qint64 > (
+				rowCount - 1 ) * i / ( c_rangeSamples - 1 ) );
+
+			QString text = q->itemText( row );
+
+			for( int j = 0; j < text.size(); ++j )
+			{
+				if( text.at( j ).isDigit() )
+					text[ j ] = widestDigit;
+			}
 
-			if( width > maxStringWidth )
-				maxStringWidth = width;
+			width = qMax( width, fm.boundingRect( text ).width() );
 		}
+
+		maxStringWidth = width;
+		widthJob.font = q->font();
+		stringWidthValid = true;
+
+		return;
 	}
+
+	// The first slice is measured right now, so small models are
+	// ready at once, big ones are finished by the IdleScheduler and
+	// geometry is updated then.
+	widthJob.restart( q->font() );
+
+	IdleScheduler * scheduler = IdleScheduler::instance();
+	scheduler->post( &widthJob );
+	scheduler->runSlice( &widthJob );
+}
+
+void
+PickerPrivate::invalidateStringWidth()
+{
+	stringWidthValid = false;
+
+	if( widthJob.isPending() )
+		IdleScheduler::instance()->cancel( &widthJob );
 }
 
 void
@@ -213,12 +610,12 @@ PickerPrivate::drawItem( QPainter * p, const QStyleOption & opt, int offset,
 	if( index.flags() & Qt::ItemIsEnabled )
 	{
 		if( index != currentIndex )
-			p->setPen( opt.palette.color( QPalette::WindowText ) );
+			p->setPen( tokens.textColor );
 		else
 			p->setPen( highlightColor );
 	}
 	else
-		p->setPen( lighterColor( opt.palette.color( QPalette::WindowText ), 75 ) );
+		p->setPen( tokens.disabledTextColor );
 
 	const QRect r( opt.rect.x() + itemSideMargin, offset,
 		opt.rect.width() - itemSideMargin * 2, stringHeight );
@@ -241,6 +638,18 @@ PickerPrivate::drawItem( QPainter * p, const QStyleOption & opt, int offset,
 	}
 }
 
+const PickerStyleTokens &
+PickerPrivate::styleTokens()
+{
+	if( !tokens.isValid() )
+		tokens.resolve( q );
+
+	tokens.updateState( q );
+	tokens.option.rect = q->rect();
+
+	return tokens;
+}
+
 QString
 PickerPrivate::makeString( const QString & text, const QRect & r,
 	int flags, const QStyleOption & opt )
@@ -253,7 +662,8 @@ PickerPrivate::drawTick( const QRect & r, QPainter * p )
 {
 	p->save();
 
-	p->setRenderHint( QPainter::Antialiasing );
+	p->setRenderHint( QPainter::Antialiasing,
+		RenderingQuality::antialiasing() );
 
 	QPen pen = p->pen();
 	pen.setWidth( 2 );
@@ -271,41 +681,44 @@ PickerPrivate::drawTick( const QRect & r, QPainter * p )
 void
 PickerPrivate::normalizeOffset()
 {
-	if( q->count() < itemsCount )
+	int top = topItemIndex.row();
+
+	normalizedOffset( &top, &drawItemOffset );
+
+	if( topItemIndex.isValid() && top != topItemIndex.row() )
+		topItemIndex = model->index( top, modelColumn, root );
+}
+
+void
+PickerPrivate::normalizedOffset( int * top, int * offset ) const
+{
+	const int count = q->count();
+
+	if( count < itemsCount )
 	{
-		const int freeItemsCount = ( itemsCount - q->count() );
+		const int freeItemsCount = ( itemsCount - count );
 
 		const int maxOffset = freeItemsCount * stringHeight +
 			( freeItemsCount > 0 ? freeItemsCount - 1 : 0 ) * itemTopMargin;
 
-		if( drawItemOffset < 0 )
-			drawItemOffset = 0;
-		else if( drawItemOffset > maxOffset )
-			drawItemOffset = maxOffset;
+		*offset = qBound( 0, *offset, maxOffset );
 	}
 	else
 	{
-		int fullItemsCount = drawItemOffset /
-			( itemTopMargin + stringHeight );
+		const int step = itemTopMargin + stringHeight;
+		int fullItemsCount = *offset / step;
 
-		drawItemOffset -= ( itemTopMargin + stringHeight ) * fullItemsCount;
+		*offset -= step * fullItemsCount;
 
-		if( fullItemsCount < 0 )
-		{
-			for( int i = fullItemsCount; i < 0; ++i )
-				makeNextIndex( topItemIndex );
-		}
-		else if( fullItemsCount > 0 )
+		if( *offset > 0 )
 		{
-			for( int i = 0; i < fullItemsCount; ++i )
-				makePrevIndex( topItemIndex );
+			*offset -= step;
+			++fullItemsCount;
 		}
 
-		if( drawItemOffset > 0 )
-		{
-			drawItemOffset -= ( itemTopMargin + stringHeight );
-			makePrevIndex( topItemIndex );
-		}
+		// Rows are wrapped around.
+		if( count > 0 && *top >= 0 )
+			*top = ( ( *top - fullItemsCount ) % count + count ) % count;
 	}
 }
 
@@ -410,6 +823,47 @@ PickerPrivate::isRowsVisible( int start, int end )
 	return false;
 }
 
+QVector< int >
+PickerPrivate::visibleRows( int * offset ) const
+{
+	QVector< int > rows;
+
+	*offset = 0;
+
+	const int count = q->count();
+
+	if( count == 0 || !topItemIndex.isValid() )
+		return rows;
+
+	// The same state paintEvent() draws after normalizeOffset().
+	int top = topItemIndex.row();
+	*offset = drawItemOffset;
+
+	normalizedOffset( &top, offset );
+
+	int maxCount = itemsCount;
+
+	if( count >= itemsCount )
+		++maxCount;
+
+	for( int i = top, scanedItems = 0;
+		scanedItems < maxCount && scanedItems < count; ++i, ++scanedItems )
+	{
+		if( i == count )
+			i = 0;
+
+		rows.append( i );
+	}
+
+	return rows;
+}
+
+bool
+PickerPrivate::isRangeMode() const
+{
+	return ( rangeModel && model == rangeModel );
+}
+
 
 //
 // Picker
@@ -519,6 +973,10 @@ Picker::setModel( QAbstractItemModel * model )
 	}
 
 	d->model = model;
+	d->invalidateStringWidth();
+
+	if( model != d->rangeModel )
+		d->rangeModel = 0;
 
 	connect( model, &QAbstractItemModel::dataChanged,
 		this, &Picker::_q_dataChanged );
@@ -558,6 +1016,8 @@ Picker::setModel( QAbstractItemModel * model )
 		setCurrentIndex( -1 );
 		d->topItemIndex = QModelIndex();
 	}
+
+	AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
 }
 
 QModelIndex
@@ -570,6 +1030,7 @@ void
 Picker::setRootModelIndex( const QModelIndex & index )
 {
 	d->root = QPersistentModelIndex( index );
+	d->invalidateStringWidth();
 	update();
 }
 
@@ -583,6 +1044,7 @@ void
 Picker::setModelColumn( int visibleColumn )
 {
 	d->modelColumn = visibleColumn;
+	d->invalidateStringWidth();
 
 	setCurrentIndex( currentIndex() ); //update the text to the text of the new column;
 }
@@ -775,12 +1237,104 @@ Picker::setHighlightColor( const QColor & c )
 	}
 }
 
+void
+Picker::setRange( qreal minimum, qreal maximum, qreal step )
+{
+	if( step <= 0.0 )
+	{
+		qWarning( "QtMWidgets::Picker::setRange: Invalid step (%f) must be > 0",
+			step );
+		return;
+	}
+
+	if( maximum < minimum )
+	{
+		qWarning( "QtMWidgets::Picker::setRange: Invalid range, "
+			"minimum (%f) > maximum (%f)", minimum, maximum );
+		return;
+	}
+
+	d->rangeModel = new PickerRangeModel( minimum, maximum, step,
+		d->rangeFormatter, this );
+
+	d->modelColumn = 0;
+	d->root = QPersistentModelIndex();
+
+	setModel( d->rangeModel );
+
+	updateGeometry();
+}
+
+bool
+Picker::isRangeMode() const
+{
+	return d->isRangeMode();
+}
+
+Picker::RangeFormatter
+Picker::rangeFormatter() const
+{
+	return d->rangeFormatter;
+}
+
+void
+Picker::setRangeFormatter( const RangeFormatter & f )
+{
+	d->rangeFormatter = f;
+
+	if( d->isRangeMode() )
+	{
+		d->rangeModel->setFormatter( f );
+
+		updateGeometry();
+	}
+}
+
+qreal
+Picker::itemValue( int index ) const
+{
+	if( d->isRangeMode() && index >= 0 && index < count() )
+		return d->rangeModel->value( index );
+	else
+		return 0.0;
+}
+
+qreal
+Picker::currentValue() const
+{
+	return itemValue( currentIndex() );
+}
+
+void
+Picker::setCurrentValue( qreal value )
+{
+	if( d->isRangeMode() && count() > 0 )
+		setCurrentIndex( d->rangeModel->row( value ) );
+}
+
 Scroller *
 Picker::scroller() const
 {
 	return d->scroller;
 }
 
+MemoryUsage
+Picker::memoryUsage() const
+{
+	MemoryUsage u;
+	u.add( MemoryUsage::Data, widgetBytes( sizeof( Picker ) ) +
+		sizeof( PickerPrivate ) - sizeof( PickerStyleTokens ) );
+	u.add( MemoryUsage::Caches, sizeof( PickerStyleTokens ) );
+	u.add( MemoryUsage::Animations,
+		sizeof( Scroller ) + sizeof( QVariantAnimation ) );
+
+	// Items of the range model are generated on demand.
+	if( d->model && d->model->parent() == this && !d->isRangeMode() )
+		u.add( MemoryUsage::Data, estimatedBytes( d->model, d->modelColumn ) );
+
+	return u;
+}
+
 QSize
 Picker::sizeHint() const
 {
@@ -842,6 +1396,8 @@ Picker::scrollTo( int index )
 		d->drawItemOffset = 0;
 
 		update();
+
+		AccessibleUpdates::post( this, AccessibleUpdates::Scrolled );
 	}
 }
 
@@ -866,9 +1422,13 @@ void
 Picker::_q_dataChanged( const QModelIndex & topLeft,
 	const QModelIndex & bottomRight )
 {
+	d->invalidateStringWidth();
+
 	if( d->inserting || topLeft.parent() != d->root )
 		return;
 
+	AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
 	if( d->currentIndex.row() >= topLeft.row() &&
 		d->currentIndex.row() <= bottomRight.row() )
 	{
@@ -896,9 +1456,13 @@ Picker::_q_updateIndexBeforeChange()
 void
 Picker::_q_rowsInserted( const QModelIndex & parent, int start, int end )
 {
+	d->invalidateStringWidth();
+
 	if( d->inserting || parent != d->root )
 		return;
 
+	AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
 	// set current index if picker was previously empty
 	if( start == 0 && ( end - start + 1 ) == count() &&
 		!d->currentIndex.isValid() )
@@ -919,9 +1483,13 @@ Picker::_q_rowsInserted( const QModelIndex & parent, int start, int end )
 void
 Picker::_q_rowsRemoved( const QModelIndex & parent, int start, int end )
 {
+	d->invalidateStringWidth();
+
 	if( parent != d->root )
 		return;
 
+	AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
 	// model has changed the currentIndex
 	if( d->currentIndex.row() != d->indexBeforeChange )
 	{
@@ -949,6 +1517,10 @@ Picker::_q_modelDestroyed()
 void
 Picker::_q_modelReset()
 {
+	d->invalidateStringWidth();
+
+	AccessibleUpdates::post( this, AccessibleUpdates::ModelChanged );
+
 	if( d->currentIndex.row() != d->indexBeforeChange )
 		_q_emitCurrentIndexChanged( d->currentIndex );
 
@@ -962,17 +1534,19 @@ Picker::_q_scroll( int dx, int dy )
 
 	d->drawItemOffset += dy;
 	update();
+
+	AccessibleUpdates::post( this, AccessibleUpdates::Scrolled );
 }
 
 void
 Picker::paintEvent( QPaintEvent * )
 {
-	QStyleOption opt;
-	opt.initFrom( this );
+	const PickerStyleTokens & t = d->styleTokens();
+	const QStyleOption & opt = t.option;
 
 	QPainter p( this );
 
-	drawCylinder( &p, opt.rect, palette().color( QPalette::Dark ) );
+	drawCylinder( &p, opt.rect, t.cylinder );
 
 	if( count() > 0 )
 	{
@@ -1024,6 +1598,8 @@ Picker::wheelEvent( QWheelEvent * event )
 		update();
 	}
 
+	AccessibleUpdates::post( this, AccessibleUpdates::Scrolled );
+
 	event->accept();
 }
 
@@ -1073,10 +1649,21 @@ Picker::mouseMoveEvent( QMouseEvent * event )
 		d->mousePos = event->pos();
 		update();
 
+		AccessibleUpdates::post( this, AccessibleUpdates::Scrolled );
+
 		event->accept();
 	}
 	else
 		event->ignore();
 }
 
+void
+Picker::changeEvent( QEvent * event )
+{
+	if( StyleTokens::isInvalidatedBy( event ) )
+		d->tokens.invalidate();
+
+	QWidget::changeEvent( event );
+}
+
 } /* namespace QtMWidgets */
@@ -13,6 +13,12 @@
 #include <QAbstractItemModel>
 #include <QVariant>
 
+// C++ include.
+#include <functional>
+
+// QtMWidgets include.
+#include "memoryusage.hpp"
+
 
 namespace QtMWidgets {
 
@@ -33,6 +39,11 @@ class PickerPrivate;
 	The interfase of the Picker is similar to the QComboBox interface.
 	Picker like a QComboBox uses model/view framework too. By default
 	picker uses QStandardItemModel as underlying model.
+
+	For large numeric ranges picker can be switched to the range mode
+	with setRange(). In this mode items are not stored anywhere, they are
+	computed on demand from minimum, maximum and step, and formatted
+	with the range formatter only when they are shown.
 */
 class Picker
 	:	public QWidget
@@ -147,6 +158,9 @@ signals:
 	void currentTextChanged( const QString & text );
 
 public:
+	//! Formatter of the item's value in the range mode.
+	typedef std::function< QString ( qreal ) > RangeFormatter;
+
 	Picker( QWidget * parent = 0, Qt::WindowFlags f = Qt::WindowFlags() );
 
 	virtual ~Picker();
@@ -332,9 +346,52 @@ public:
 	//! Set color used to highlight the current item.
 	void setHighlightColor( const QColor & c );
 
+	/*!
+		Switch picker to the range mode. Items of the picker will be
+		values from \a minimum to \a maximum with the given \a step.
+		Items are computed on demand and formatted with the range
+		formatter only when needed, so the range can be very large.
+
+		This function replaces current model of the picker. Items
+		can't be inserted or removed in the range mode.
+
+		\sa setRangeFormatter(), isRangeMode()
+	*/
+	void setRange( qreal minimum, qreal maximum, qreal step = 1.0 );
+	//! \return Is picker in the range mode?
+	bool isRangeMode() const;
+
+	//! \return Formatter used in the range mode.
+	RangeFormatter rangeFormatter() const;
+	/*!
+		Set formatter used in the range mode. If formatter is not set
+		values are shown with the count of decimals of the step.
+	*/
+	void setRangeFormatter( const RangeFormatter & f );
+
+	/*!
+		\return Value of the item with the given \a index in the
+		range mode, 0.0 otherwise.
+	*/
+	qreal itemValue( int index ) const;
+	//! \return Current value in the range mode, 0.0 otherwise.
+	qreal currentValue() const;
+	/*!
+		Set current item to the item nearest to the given \a value.
+
+		This function does nothing if picker is not in the range mode.
+	*/
+	void setCurrentValue( qreal value );
+
 	//! \return Scroller interface.
 	Scroller * scroller() const;
 
+	/*!
+		\return Approximate memory owned by the picker, including
+		own model.
+	*/
+	MemoryUsage memoryUsage() const;
+
 	QSize sizeHint() const override;
 	QSize minimumSizeHint() const override;
 
@@ -378,9 +435,11 @@ protected:
 	void mousePressEvent( QMouseEvent * event ) override;
 	void mouseReleaseEvent( QMouseEvent * event ) override;
 	void mouseMoveEvent( QMouseEvent * event ) override;
+	void changeEvent( QEvent * event ) override;
 
 private:
 	friend class PickerPrivate;
+	friend class PickerAccessible;
 
 	Q_DISABLE_COPY( Picker )
 
@@ -12,6 +12,7 @@
 
 // Qt include.
 #include <QWidget>
+#include <QPen>
 
 QT_BEGIN_NAMESPACE
 class QStyleOption;
@@ -35,11 +36,14 @@ public:
 	QSize minimumSizeHint() const override;
 	QSize sizeHint() const override;
 
+	//! Set color of the indicator.
+	void setColor( const QColor & c );
+
 protected:
 	void paintEvent( QPaintEvent * ) override;
 
 private:
-	void drawIndicator( QPainter * p, const QColor & c );
+	void drawIndicator( QPainter * p );
 
 protected:
 	friend class AbstractScrollAreaPrivate;
@@ -53,6 +57,7 @@ protected:
 	Qt::Orientation orientation;
 	bool needPaint;
 	QColor color;
+	QPen pen;
 	bool animate;
 	int alpha;
 }; // class ScrollIndicator
@@ -87,9 +92,71 @@ protected:
 	int pressure;
 	int darkBlurWidth;
 	qreal maxPressure;
+	bool interacting;
 }; // class BlurEffect
 
 
+class AbstractScrollAreaPrivate;
+
+
+//
+// Scrubber
+//
+
+//! Track at the right edge of the viewport for jumping through the area.
+class Scrubber
+	:	public QWidget
+{
+public:
+	Scrubber( AbstractScrollAreaPrivate * dd, const QColor & c,
+		QWidget * parent );
+
+	QSize sizeHint() const override;
+
+protected:
+	void paintEvent( QPaintEvent * ) override;
+	void mousePressEvent( QMouseEvent * e ) override;
+	void mouseMoveEvent( QMouseEvent * e ) override;
+	void mouseReleaseEvent( QMouseEvent * e ) override;
+
+protected:
+	friend class AbstractScrollAreaPrivate;
+	friend class AbstractScrollArea;
+
+	AbstractScrollAreaPrivate * d;
+	QColor color;
+	bool pressed;
+}; // class Scrubber
+
+
+//
+// ScrubberLabel
+//
+
+//! Label shown in the middle of the viewport while scrubbing.
+class ScrubberLabel
+	:	public QWidget
+{
+public:
+	ScrubberLabel( const QColor & c, QWidget * parent );
+
+	QSize sizeHint() const override;
+
+	//! Set text.
+	void setText( const QString & t );
+
+protected:
+	void paintEvent( QPaintEvent * ) override;
+
+protected:
+	friend class AbstractScrollAreaPrivate;
+
+	QColor color;
+	QString text;
+	bool interacting;
+}; // class ScrubberLabel
+
+
 class Scroller;
 
 //
@@ -101,6 +168,10 @@ public:
 	explicit AbstractScrollAreaPrivate( AbstractScrollArea * parent )
 		:	q( parent )
 		,	viewport( 0 )
+		,	helpersParent( 0 )
+		,	horIndicatorPolicy( AbstractScrollArea::ScrollIndicatorAsNeeded )
+		,	vertIndicatorPolicy( AbstractScrollArea::ScrollIndicatorAsNeeded )
+		,	blurPolicy( AbstractScrollArea::BlurAlwaysOff )
 		,	scrolledAreaSize( 0, 0 )
 		,	topLeftCorner( 0, 0 )
 		,	top( 0 )
@@ -108,10 +179,13 @@ public:
 		,	right( 0 )
 		,	left( 0 )
 		,	leftMouseButtonPressed( false )
+		,	interacting( false )
+		,	kineticScrolling( false )
 		,	horIndicator( 0 )
 		,	vertIndicator( 0 )
 		,	animationTimer( 0 )
 		,	startBlurAnimTimer( 0 )
+		,	wheelInteractionTimer( 0 )
 		,	animationTimeout( 100 )
 		,	animationAlphaDelta( 25 )
 		,	scroller( 0 )
@@ -119,6 +193,9 @@ public:
 		,	vertBlur( 0 )
 		,	horBlurAnim( 0 )
 		,	vertBlurAnim( 0 )
+		,	scrubberEnabled( false )
+		,	scrubber( 0 )
+		,	scrubberLabel( 0 )
 	{
 	}
 
@@ -135,6 +212,34 @@ public:
 	void stopAnimatingBlurEffect();
 	void animateScrollIndicators();
 	void stopScrollIndicatorsAnimation();
+	//! Create scroll indicators if they were not created yet.
+	void ensureIndicators();
+	//! Create animation timer of the scroll indicators if needed.
+	void ensureAnimationTimer();
+	//! Create blur effects and its animations if they were not created yet.
+	void ensureBlur();
+	//! Create timer that starts hidding of the blur effect if needed.
+	void ensureStartBlurAnimTimer();
+	//! Create timer that finishes interaction started by wheel if needed.
+	void ensureWheelInteractionTimer();
+	//! Set interaction state, repaint in full quality when it's finished.
+	void setInteracting( bool on );
+	//! Resize blur effects to the size of the viewport.
+	void layoutBlur();
+	//! \return Is any of the scroll indicators should be painted.
+	bool indicatorsNeedPaint() const;
+	//! Reparent indicators and blur effects to the given widget.
+	void setHelpersParent( QWidget * parent );
+	//! \return Estimated amount of memory used by the lazily created helpers.
+	qint64 helpersMemoryUsage() const;
+	//! Create scrubber and its label if they were not created yet.
+	void ensureScrubber();
+	//! Place scrubber at the right edge of the viewport and show it if needed.
+	void layoutScrubber();
+	//! Jump to the position of the scrubber at \a y.
+	void scrubTo( int y );
+	//! Finish dragging of the scrubber.
+	void finishScrubbing();
 
 	virtual ~AbstractScrollAreaPrivate()
 	{
@@ -142,7 +247,12 @@ public:
 
 	AbstractScrollArea * q;
 	QColor indicatorColor;
+	QColor blurColor;
 	QWidget * viewport;
+	QWidget * helpersParent;
+	AbstractScrollArea::ScrollIndicatorPolicy horIndicatorPolicy;
+	AbstractScrollArea::ScrollIndicatorPolicy vertIndicatorPolicy;
+	AbstractScrollArea::BlurPolicy blurPolicy;
 	QSize scrolledAreaSize;
 	QPoint topLeftCorner;
 	int top;
@@ -150,11 +260,14 @@ public:
 	int right;
 	int left;
 	bool leftMouseButtonPressed;
+	bool interacting;
+	bool kineticScrolling;
 	QPoint mousePos;
 	ScrollIndicator * horIndicator;
 	ScrollIndicator * vertIndicator;
 	QTimer * animationTimer;
 	QTimer * startBlurAnimTimer;
+	QTimer * wheelInteractionTimer;
 	int animationTimeout;
 	int animationAlphaDelta;
 	Scroller * scroller;
@@ -162,6 +275,10 @@ public:
 	BlurEffect * vertBlur;
 	QVariantAnimation * horBlurAnim;
 	QVariantAnimation * vertBlurAnim;
+	bool scrubberEnabled;
+	Scrubber * scrubber;
+	ScrubberLabel * scrubberLabel;
+	AbstractScrollArea::ScrubberLabelFunction scrubberLabelFunction;
 }; // class AbstractScrollAreaPrivate
 
 } /* namespace QtMWidgets */
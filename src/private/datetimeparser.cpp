@@ -13,6 +13,141 @@
 
 namespace QtMWidgets {
 
+//
+// DateTimeFields
+//
+
+DateTimeFields::DateTimeFields()
+	:	year( 0 )
+	,	month( 1 )
+	,	day( 1 )
+	,	hour( 0 )
+	,	minute( 0 )
+	,	second( 0 )
+	,	msec( 0 )
+{
+}
+
+DateTimeFields::DateTimeFields( int y, int mo, int d, int h, int mi,
+	int s, int ms )
+	:	year( y )
+	,	month( mo )
+	,	day( d )
+	,	hour( h )
+	,	minute( mi )
+	,	second( s )
+	,	msec( ms )
+{
+}
+
+DateTimeFields
+DateTimeFields::fromDateTime( const QDateTime & dt )
+{
+	DateTimeFields f;
+	f.setDate( dt.date() );
+	f.setTime( dt.time() );
+
+	return f;
+}
+
+QDateTime
+DateTimeFields::toDateTime( Qt::TimeSpec spec ) const
+{
+	return QDateTime( date(), time(), spec );
+}
+
+QDate
+DateTimeFields::date() const
+{
+	return QDate( year, month, day );
+}
+
+QTime
+DateTimeFields::time() const
+{
+	return QTime( hour, minute, second, msec );
+}
+
+void
+DateTimeFields::setDate( const QDate & d )
+{
+	year = d.year();
+	month = d.month();
+	day = d.day();
+}
+
+void
+DateTimeFields::setTime( const QTime & t )
+{
+	hour = t.hour();
+	minute = t.minute();
+	second = t.second();
+	msec = t.msec();
+}
+
+int
+DateTimeFields::daysInMonth( int year, int month )
+{
+	static const int days[ 12 ] =
+		{ 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+	if( month < 1 || month > 12 )
+		return 0;
+
+	if( month == 2 &&
+		( ( year % 4 == 0 && year % 100 != 0 ) || year % 400 == 0 ) )
+			return 29;
+
+	return days[ month - 1 ];
+}
+
+int
+DateTimeFields::dayOfWeek( int year, int month, int day )
+{
+	static const int offsets[ 12 ] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+
+	if( month < 3 )
+		year -= 1;
+
+	// 0 is Sunday.
+	const int d = ( year + year / 4 - year / 100 + year / 400 +
+		offsets[ month - 1 ] + day ) % 7;
+
+	return ( d == 0 ? 7 : d );
+}
+
+bool operator == ( const DateTimeFields & f1, const DateTimeFields & f2 )
+{
+	return ( f1.year == f2.year && f1.month == f2.month &&
+		f1.day == f2.day && f1.hour == f2.hour &&
+		f1.minute == f2.minute && f1.second == f2.second &&
+		f1.msec == f2.msec );
+}
+
+bool operator != ( const DateTimeFields & f1, const DateTimeFields & f2 )
+{
+	return !( f1 == f2 );
+}
+
+bool operator < ( const DateTimeFields & f1, const DateTimeFields & f2 )
+{
+	if( f1.year != f2.year )
+		return f1.year < f2.year;
+	if( f1.month != f2.month )
+		return f1.month < f2.month;
+	if( f1.day != f2.day )
+		return f1.day < f2.day;
+	if( f1.hour != f2.hour )
+		return f1.hour < f2.hour;
+	if( f1.minute != f2.minute )
+		return f1.minute < f2.minute;
+	if( f1.second != f2.second )
+		return f1.second < f2.second;
+
+	return f1.msec < f2.msec;
+}
+
+
 //
 // Section
 //
@@ -123,7 +258,7 @@ int
 Section::maxWidth( const QStyleOption & opt ) const
 {
 	int width = opt.fontMetrics.boundingRect( value(
-		DATETIMEPICKER_DATETIME_MAX ) ).width();
+		DATETIMEPICKER_FIELDS_MAX ) ).width();
 
 	width += opt.fontMetrics.averageCharWidth() / 3;
 
@@ -171,15 +306,15 @@ makeSectionValue( QString & v, int section, bool zeroesAdded )
 }
 
 QString
-Section::value( const QDateTime & dt ) const
+Section::value( const DateTimeFields & dt ) const
 {
 	QString v;
 
 	switch( type )
 	{
 		case AmPmSection :
-			if( ( dt.time().hour() > 12 && dt.time().hour() <= 23 ) ||
-				dt.time().hour() == 0 )
+			if( ( dt.hour > 12 && dt.hour <= 23 ) ||
+				dt.hour == 0 )
 					return QLatin1String( "PM" );
 			else
 				return QLatin1String( "AM" );
@@ -187,21 +322,21 @@ Section::value( const QDateTime & dt ) const
 
 		case SecondSection :
 		{
-			makeSectionValue( v, dt.time().second(), zeroesAdded );
+			makeSectionValue( v, dt.second, zeroesAdded );
 			return v;
 		}
 		break;
 
 		case MinuteSection :
 		{
-			makeSectionValue( v, dt.time().minute(), zeroesAdded );
+			makeSectionValue( v, dt.minute, zeroesAdded );
 			return v;
 		}
 		break;
 
 		case Hour12Section :
 		{
-			int hour = dt.time().hour();
+			int hour = dt.hour;
 
 			if( hour > 12 )
 				hour -= 12;
@@ -216,7 +351,7 @@ Section::value( const QDateTime & dt ) const
 
 		case Hour24Section :
 		{
-			makeSectionValue( v, dt.time().hour(), zeroesAdded );
+			makeSectionValue( v, dt.hour, zeroesAdded );
 			return v;
 		}
 		break;
@@ -225,14 +360,14 @@ Section::value( const QDateTime & dt ) const
 		case DaySectionShort :
 		case DaySectionLong :
 		{
-			makeSectionValue( v, dt.date().day(), zeroesAdded );
+			makeSectionValue( v, dt.day, zeroesAdded );
 			return v;
 		}
 		break;
 
 		case MonthSection :
 		{
-			makeSectionValue( v, dt.date().month(), zeroesAdded );
+			makeSectionValue( v, dt.month, zeroesAdded );
 			return v;
 		}
 		break;
@@ -244,14 +379,14 @@ Section::value( const QDateTime & dt ) const
 
 		case YearSection :
 		{
-			makeSectionValue( v, dt.date().year(), zeroesAdded );
+			makeSectionValue( v, dt.year, zeroesAdded );
 			return v;
 		}
 		break;
 
 		case YearSection2Digits :
 		{
-			makeSectionValue( v, dt.date().year(), zeroesAdded );
+			makeSectionValue( v, dt.year, zeroesAdded );
 			return v.right( 2 );
 		}
 		break;
@@ -265,8 +400,8 @@ Section::value( const QDateTime & dt ) const
 }
 
 void
-Section::fillValues( const QDateTime & current,
-	const QDateTime & min, const QDateTime & max,
+Section::fillValues( const DateTimeFields & current,
+	const DateTimeFields & min, const DateTimeFields & max,
 	bool updateIndex )
 {
 	values.clear();
@@ -281,7 +416,7 @@ Section::fillValues( const QDateTime & current,
 			values.append( QLatin1String( "AM" ) );
 			values.append( QLatin1String( "PM" ) );
 
-			if( current.time().hour() >= 12 )
+			if( current.hour >= 12 )
 				currentIndex = 1;
 			else
 				currentIndex = 0;
@@ -290,7 +425,7 @@ Section::fillValues( const QDateTime & current,
 
 		case SecondSection :
 		{
-			const int s = current.time().second();
+			const int s = current.second;
 
 			for( int i = 0; i < 60; ++i )
 			{
@@ -308,7 +443,7 @@ Section::fillValues( const QDateTime & current,
 
 		case MinuteSection :
 		{
-			const int m = current.time().minute();
+			const int m = current.minute;
 
 			for( int i = 0; i < 60; ++i )
 			{
@@ -327,7 +462,7 @@ Section::fillValues( const QDateTime & current,
 		case Hour12Section :
 		{
 			int h = 0;
-			int currentHour = current.time().hour();
+			int currentHour = current.hour;
 
 			if( currentHour == 0 )
 				h = 12;
@@ -352,7 +487,7 @@ Section::fillValues( const QDateTime & current,
 
 		case Hour24Section :
 		{
-			const int h = current.time().hour();
+			const int h = current.hour;
 
 			for( int i = 0; i < 24; ++i )
 			{
@@ -370,9 +505,11 @@ Section::fillValues( const QDateTime & current,
 
 		case DaySection :
 		{
-			const int d = current.date().day();
+			const int d = current.day;
+			const int daysInMonth = DateTimeFields::daysInMonth(
+				current.year, current.month );
 
-			for( int i = 1; i <= current.date().daysInMonth(); ++i )
+			for( int i = 1; i <= daysInMonth; ++i )
 			{
 				QString v;
 
@@ -388,11 +525,14 @@ Section::fillValues( const QDateTime & current,
 
 		case DaySectionShort :
 		{
-			const int d = current.date().day();
+			const int d = current.day;
+			const int daysInMonth = DateTimeFields::daysInMonth(
+				current.year, current.month );
 
-			QDate date( current.date().year(), current.date().month(), 1 );
+			int dayOfWeek = DateTimeFields::dayOfWeek( current.year,
+				current.month, 1 );
 
-			for( int i = 1; i <= current.date().daysInMonth(); ++i )
+			for( int i = 1; i <= daysInMonth; ++i )
 			{
 				QString v;
 
@@ -403,22 +543,25 @@ Section::fillValues( const QDateTime & current,
 
 				v.prepend( QLatin1Char( ' ' ) );
 
-				v.prepend( QLocale::system().dayName( date.dayOfWeek(), QLocale::ShortFormat ) );
+				v.prepend( QLocale::system().dayName( dayOfWeek, QLocale::ShortFormat ) );
 
 				values.append( v );
 
-				date = date.addDays( 1 );
+				dayOfWeek = dayOfWeek % 7 + 1;
 			}
 		}
 		break;
 
 		case DaySectionLong :
 		{
-			const int d = current.date().day();
+			const int d = current.day;
+			const int daysInMonth = DateTimeFields::daysInMonth(
+				current.year, current.month );
 
-			QDate date( current.date().year(), current.date().month(), 1 );
+			int dayOfWeek = DateTimeFields::dayOfWeek( current.year,
+				current.month, 1 );
 
-			for( int i = 1; i <= current.date().daysInMonth(); ++i )
+			for( int i = 1; i <= daysInMonth; ++i )
 			{
 				QString v;
 
@@ -429,18 +572,18 @@ Section::fillValues( const QDateTime & current,
 
 				v.prepend( QLatin1Char( ' ' ) );
 
-				v.prepend( QLocale::system().dayName( date.dayOfWeek() ) );
+				v.prepend( QLocale::system().dayName( dayOfWeek ) );
 
 				values.append( v );
 
-				date = date.addDays( 1 );
+				dayOfWeek = dayOfWeek % 7 + 1;
 			}
 		}
 		break;
 
 		case MonthSection :
 		{
-			const int m = current.date().month();
+			const int m = current.month;
 
 			for( int i = 1; i < 13; ++i )
 			{
@@ -458,7 +601,7 @@ Section::fillValues( const QDateTime & current,
 
 		case MonthSectionShort :
 		{
-			const int m = current.date().month();
+			const int m = current.month;
 
 			for( int i = 1; i < 13; ++i )
 			{
@@ -472,7 +615,7 @@ Section::fillValues( const QDateTime & current,
 
 		case MonthSectionLong :
 		{
-			const int m = current.date().month();
+			const int m = current.month;
 
 			for( int i = 1; i < 13; ++i )
 			{
@@ -486,9 +629,9 @@ Section::fillValues( const QDateTime & current,
 
 		case YearSection :
 		{
-			int start = min.date().year();
-			const int finish = max.date().year();
-			const int y = current.date().year();
+			int start = min.year;
+			const int finish = max.year;
+			const int y = current.year;
 
 			while( start <= finish )
 			{
@@ -508,9 +651,9 @@ Section::fillValues( const QDateTime & current,
 
 		case YearSection2Digits :
 		{
-			int start = min.date().year();
-			const int finish = max.date().year();
-			const int y = current.date().year();
+			int start = min.year;
+			const int finish = max.year;
+			const int y = current.year;
 
 			while( start <= finish )
 			{
@@ -538,10 +681,34 @@ Section::fillValues( const QDateTime & current,
 // DateTimeParser
 //
 
+static_assert( int( DateTimeFormat::AmPm ) == int( Section::AmPmSection ) &&
+	int( DateTimeFormat::Second ) == int( Section::SecondSection ) &&
+	int( DateTimeFormat::Minute ) == int( Section::MinuteSection ) &&
+	int( DateTimeFormat::Hour12 ) == int( Section::Hour12Section ) &&
+	int( DateTimeFormat::Hour24 ) == int( Section::Hour24Section ) &&
+	int( DateTimeFormat::Day ) == int( Section::DaySection ) &&
+	int( DateTimeFormat::DayShort ) == int( Section::DaySectionShort ) &&
+	int( DateTimeFormat::DayLong ) == int( Section::DaySectionLong ) &&
+	int( DateTimeFormat::Month ) == int( Section::MonthSection ) &&
+	int( DateTimeFormat::MonthShort ) == int( Section::MonthSectionShort ) &&
+	int( DateTimeFormat::MonthLong ) == int( Section::MonthSectionLong ) &&
+	int( DateTimeFormat::Year ) == int( Section::YearSection ) &&
+	int( DateTimeFormat::Year2Digits ) == int( Section::YearSection2Digits ),
+	"DateTimeFormat::Field should match Section::Type." );
+
+constexpr DateTimeFormat DateTimeParser::defaultFormat;
+
 DateTimeParser::DateTimeParser( QMetaType::Type t )
 	:	type( t )
 {
-	parseFormat( QLatin1String( "dddd MMMM yyyy hh mm" ) );
+	loadFormat( defaultFormat );
+}
+
+DateTimeParser::DateTimeParser( QMetaType::Type t, const DateTimeFormat & fmt )
+	:	type( t )
+{
+	if( !loadFormat( fmt ) )
+		loadFormat( defaultFormat );
 }
 
 DateTimeParser::~DateTimeParser()
@@ -779,11 +946,11 @@ DateTimeParser::parseFormat( const QString & fmt )
 				}
 			} break;
 
-			case ' ' :
-				break;
-
 			default :
 			{
+				if( DateTimeFormat::isSeparator( fmt.at( i ).toLatin1() ) )
+					break;
+
 				qWarning( "DateTimeParser: prohibited character in the format string." );
 				return false;
 			}
@@ -796,4 +963,38 @@ DateTimeParser::parseFormat( const QString & fmt )
 	return true;
 }
 
+bool
+DateTimeParser::loadFormat( const DateTimeFormat & fmt )
+{
+	if( !fmt.isValid() || fmt.count() == 0 )
+		return false;
+
+	static const int timeMask = Section::AmPmSection | Section::SecondSection |
+		Section::MinuteSection | Section::Hour12Section | Section::Hour24Section;
+	static const int dateMask = Section::DaySectionMask |
+		Section::MonthSectionMask | Section::YearSectionMask;
+
+	QVector< Section > newSections;
+	newSections.reserve( fmt.count() );
+
+	for( int i = 0; i < fmt.count(); ++i )
+	{
+		const Section::Type t = static_cast< Section::Type > ( fmt.field( i ) );
+
+		if( ( type == QMetaType::QDate && ( t & timeMask ) ) ||
+			( type == QMetaType::QTime && ( t & dateMask ) ) )
+				continue;
+
+		Section s( t );
+		s.zeroesAdded = fmt.zeroesAdded( i );
+
+		newSections.append( s );
+	}
+
+	sections.swap( newSections );
+	format = QString::fromLatin1( fmt.format() );
+
+	return true;
+}
+
 } /* namespace QtMWidgets */
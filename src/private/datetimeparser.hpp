@@ -13,6 +13,9 @@
 #include <QDateTime>
 #include <QVector>
 
+// QtMWidgets include.
+#include "../datetimeformat.hpp"
+
 QT_BEGIN_NAMESPACE
 class QStyleOption;
 QT_END_NAMESPACE
@@ -27,10 +30,69 @@ QT_END_NAMESPACE
 #define DATETIMEPICKER_DATETIME_MIN QDateTime( DATETIMEPICKER_DATE_MIN, DATETIMEPICKER_TIME_MIN )
 #define DATETIMEPICKER_DATETIME_MAX QDateTime( DATETIMEPICKER_DATE_MAX, DATETIMEPICKER_TIME_MAX )
 #define DATETIMEPICKER_DATE_INITIAL QDate( 2000, 1, 1 )
+#define DATETIMEPICKER_FIELDS_MIN DateTimeFields( 100, 1, 1, 0, 0, 0, 0 )
+#define DATETIMEPICKER_COMPAT_FIELDS_MIN DateTimeFields( 1752, 9, 14, 0, 0, 0, 0 )
+#define DATETIMEPICKER_FIELDS_MAX DateTimeFields( 7999, 12, 31, 23, 59, 59, 999 )
+#define DATETIMEPICKER_FIELDS_INITIAL DateTimeFields( 2000, 1, 1, 0, 0, 0, 0 )
 
 
 namespace QtMWidgets {
 
+//
+// DateTimeFields
+//
+
+/*!
+	Broken-down date & time. DateTimePicker keeps its state in these
+	fields, QDateTime is built only on the API boundary.
+*/
+class DateTimeFields {
+public:
+	DateTimeFields();
+
+	DateTimeFields( int y, int mo, int d, int h, int mi, int s, int ms );
+
+	//! \return Fields of the given \a dt.
+	static DateTimeFields fromDateTime( const QDateTime & dt );
+
+	//! \return Date & time with the given time \a spec.
+	QDateTime toDateTime( Qt::TimeSpec spec ) const;
+	//! \return Date.
+	QDate date() const;
+	//! \return Time.
+	QTime time() const;
+	//! Set date.
+	void setDate( const QDate & d );
+	//! Set time.
+	void setTime( const QTime & t );
+
+	//! \return Count of days in the given \a month of the \a year.
+	static int daysInMonth( int year, int month );
+
+	//! \return Day of week, 1 = Monday to 7 = Sunday.
+	static int dayOfWeek( int year, int month, int day );
+
+	//! Year.
+	int year;
+	//! Month, 1-12.
+	int month;
+	//! Day, 1-31.
+	int day;
+	//! Hour, 0-23.
+	int hour;
+	//! Minute.
+	int minute;
+	//! Second.
+	int second;
+	//! Milliseconds.
+	int msec;
+}; // class DateTimeFields
+
+bool operator == ( const DateTimeFields & f1, const DateTimeFields & f2 );
+bool operator != ( const DateTimeFields & f1, const DateTimeFields & f2 );
+bool operator < ( const DateTimeFields & f1, const DateTimeFields & f2 );
+
+
 //
 // Section
 //
@@ -69,11 +131,11 @@ public:
 	int maxWidth( const QStyleOption & opt ) const;
 
 	//! \return Value of the section for the given \a dt date & time.
-	QString value( const QDateTime & dt ) const;
+	QString value( const DateTimeFields & dt ) const;
 
 	//! Fill values.
-	void fillValues( const QDateTime & current,
-		const QDateTime & min, const QDateTime & max,
+	void fillValues( const DateTimeFields & current,
+		const DateTimeFields & min, const DateTimeFields & max,
 		bool updateIndex = true );
 
 	//! Type of the section.
@@ -103,6 +165,9 @@ class DateTimeParser {
 public:
 	explicit DateTimeParser( QMetaType::Type t );
 
+	//! Construct parser with sections from the given \a fmt descriptor.
+	DateTimeParser( QMetaType::Type t, const DateTimeFormat & fmt );
+
 	virtual ~DateTimeParser();
 
 	/*!
@@ -115,6 +180,18 @@ public:
 	*/
 	bool parseFormat( const QString & fmt );
 
+	/*!
+		Load sections from the compile-time format descriptor.
+		Nothing is parsed here, sections are copied from the table.
+
+		\return Is format valid.
+	*/
+	bool loadFormat( const DateTimeFormat & fmt );
+
+	//! Default format "dddd MMMM yyyy hh mm".
+	static constexpr DateTimeFormat defaultFormat =
+		DateTimeFormat( "dddd MMMM yyyy hh mm" );
+
 	//! Defined sections in format.
 	QVector< Section > sections;
 	//! Type of the parser.
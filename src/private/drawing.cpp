@@ -7,6 +7,7 @@
 // QtMWidgets include.
 #include "drawing.hpp"
 #include "color.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QPainter>
@@ -20,13 +21,24 @@
 namespace QtMWidgets {
 
 //
-// drawCylinder
+// CylinderBrushes
 //
 
-void
-drawCylinder( QPainter * p, const QRect & r, const QColor & baseColor,
-	bool roundLeftCorner, bool roundRightCorner )
+CylinderBrushes::CylinderBrushes()
 {
+}
+
+CylinderBrushes::CylinderBrushes( const QColor & baseColor )
+{
+	if( !RenderingQuality::gradients() )
+	{
+		firstVertLine = QBrush( darkerColor( baseColor, 50 ) );
+		secondVertLine = QBrush( darkerColor( baseColor, 40 ) );
+		background = QBrush( lighterColor( baseColor, 75 ) );
+
+		return;
+	}
+
 	QLinearGradient firstVertLineGradient( QPointF( 0.0, 0.0 ),
 		QPointF( 0.0, 1.0 ) );
 	firstVertLineGradient.setCoordinateMode( QGradient::ObjectBoundingMode );
@@ -41,15 +53,47 @@ drawCylinder( QPainter * p, const QRect & r, const QColor & baseColor,
 	secondVertLineGradient.setColorAt( 0.5, lighterColor( baseColor, 50 ) );
 	secondVertLineGradient.setColorAt( 1.0, darkerColor( baseColor, 40 ) );
 
+	QLinearGradient backgroundGradient( QPointF( 0.0, 0.0 ),
+		QPointF( 0.0, 1.0 ) );
+	backgroundGradient.setCoordinateMode( QGradient::ObjectBoundingMode );
+	backgroundGradient.setColorAt( 0.0, baseColor );
+	backgroundGradient.setColorAt( 0.15, lighterColor( baseColor, 75 ) );
+	backgroundGradient.setColorAt( 0.5, lighterColor( baseColor, 200 ) );
+	backgroundGradient.setColorAt( 0.85, lighterColor( baseColor, 75 ) );
+	backgroundGradient.setColorAt( 1.0, baseColor );
+
+	firstVertLine = QBrush( firstVertLineGradient );
+	secondVertLine = QBrush( secondVertLineGradient );
+	background = QBrush( backgroundGradient );
+}
+
+
+//
+// drawCylinder
+//
+
+void
+drawCylinder( QPainter * p, const QRect & r, const QColor & baseColor,
+	bool roundLeftCorner, bool roundRightCorner )
+{
+	drawCylinder( p, r, CylinderBrushes( baseColor ),
+		roundLeftCorner, roundRightCorner );
+}
+
+void
+drawCylinder( QPainter * p, const QRect & r,
+	const CylinderBrushes & brushes,
+	bool roundLeftCorner, bool roundRightCorner )
+{
 	p->setPen( Qt::NoPen );
-	p->setBrush( firstVertLineGradient );
+	p->setBrush( brushes.firstVertLine );
 
 	p->drawRect( r.x(), roundLeftCorner ? 2 : 0,
 		1, roundLeftCorner ? r.height() - 4 : r.height() );
 	p->drawRect( r.x() + r.width() - 1, roundRightCorner ? 2 : 0,
 		1, roundRightCorner ? r.height() - 4 : r.height() );
 
-	p->setBrush( secondVertLineGradient );
+	p->setBrush( brushes.secondVertLine );
 
 	p->drawRect( r.x() + 1, roundLeftCorner ? 1 : 0,
 		1, roundLeftCorner ? r.height() - 2 : r.height() );
@@ -60,17 +104,8 @@ drawCylinder( QPainter * p, const QRect & r, const QColor & baseColor,
 	p->drawRect( r.x() + r.width() - 3, 0,
 		1, r.height() );
 
-	QLinearGradient backgroundGradient( QPointF( 0.0, 0.0 ),
-		QPointF( 0.0, 1.0 ) );
-	backgroundGradient.setCoordinateMode( QGradient::ObjectBoundingMode );
-	backgroundGradient.setColorAt( 0.0, baseColor );
-	backgroundGradient.setColorAt( 0.15, lighterColor( baseColor, 75 ) );
-	backgroundGradient.setColorAt( 0.5, lighterColor( baseColor, 200 ) );
-	backgroundGradient.setColorAt( 0.85, lighterColor( baseColor, 75 ) );
-	backgroundGradient.setColorAt( 1.0, baseColor );
-
 	p->setPen( Qt::NoPen );
-	p->setBrush( backgroundGradient );
+	p->setBrush( brushes.background );
 	p->drawRect( r.x() + 3, 0, r.width() - 2 * 3, r.height() );
 }
 
@@ -82,21 +117,38 @@ drawCylinder( QPainter * p, const QRect & r, const QColor & baseColor,
 void drawSliderHandle( QPainter * p, const QRect & r,
 	int xRadius, int yRadius, const QColor & borderColor,
 	const QColor & lightColor )
+{
+	drawSliderHandle( p, r, xRadius, yRadius, borderColor, lightColor,
+		sliderHandleBrush( lightColor ) );
+}
+
+void drawSliderHandle( QPainter * p, const QRect & r,
+	int xRadius, int yRadius, const QColor & borderColor,
+	const QColor & lightColor, const QBrush & handleBrush )
 {
 	p->setPen( borderColor );
 	p->setBrush( lightColor );
 	p->drawRoundedRect( r, xRadius, yRadius );
 
+	p->setPen( Qt::NoPen );
+	p->setBrush( handleBrush );
+
+	p->drawRoundedRect( r.marginsRemoved( QMargins( 2, 2, 2, 2 ) ),
+		xRadius - 4, yRadius - 4 );
+}
+
+
+QBrush sliderHandleBrush( const QColor & lightColor )
+{
+	if( !RenderingQuality::gradients() )
+		return QBrush( darkerColor( lightColor, 10 ) );
+
 	QLinearGradient g( QPointF( 0.0, 0.0 ), QPointF( 0.0, 1.0 ) );
 	g.setCoordinateMode( QGradient::ObjectBoundingMode );
 	g.setColorAt( 0.0, darkerColor( lightColor, 75 ) );
 	g.setColorAt( 1.0, darkerColor( lightColor, 10 ) );
 
-	p->setPen( Qt::NoPen );
-	p->setBrush( g );
-
-	p->drawRoundedRect( r.marginsRemoved( QMargins( 2, 2, 2, 2 ) ),
-		xRadius - 4, yRadius - 4 );
+	return QBrush( g );
 }
 
 
@@ -9,6 +9,7 @@
 
 // Qt include.
 #include <QtGlobal>
+#include <QBrush>
 
 QT_BEGIN_NAMESPACE
 class QPainter;
@@ -19,6 +20,22 @@ QT_END_NAMESPACE
 
 namespace QtMWidgets {
 
+//
+// CylinderBrushes
+//
+
+//! Brushes of the cylinder precomputed from the base color.
+class CylinderBrushes {
+public:
+	CylinderBrushes();
+	explicit CylinderBrushes( const QColor & baseColor );
+
+	QBrush firstVertLine;
+	QBrush secondVertLine;
+	QBrush background;
+}; // class CylinderBrushes
+
+
 //
 // drawCylinder
 //
@@ -27,6 +44,11 @@ namespace QtMWidgets {
 void drawCylinder( QPainter * p, const QRect & r, const QColor & baseColor,
 	bool roundLeftCorner = true, bool roundRightCorner = true );
 
+//! Draw cylinder with rect \a r with precomputed \a brushes.
+void drawCylinder( QPainter * p, const QRect & r,
+	const CylinderBrushes & brushes,
+	bool roundLeftCorner = true, bool roundRightCorner = true );
+
 
 //
 // drawSliderHandle
@@ -37,6 +59,14 @@ void drawSliderHandle( QPainter * p, const QRect & r,
 	int xRadius, int yRadius, const QColor & borderColor,
 	const QColor & lightColor );
 
+//! Draw slider's handle with precomputed \a handleBrush.
+void drawSliderHandle( QPainter * p, const QRect & r,
+	int xRadius, int yRadius, const QColor & borderColor,
+	const QColor & lightColor, const QBrush & handleBrush );
+
+//! \return Brush of the inner part of the slider's handle.
+QBrush sliderHandleBrush( const QColor & lightColor );
+
 
 //
 // drawArrow
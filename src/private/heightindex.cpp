@@ -0,0 +1,210 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "heightindex.hpp"
+
+
+namespace QtMWidgets {
+
+//
+// HeightIndex
+//
+
+HeightIndex::HeightIndex()
+	:	m_tree( 1, 0 )
+	,	m_estimatedCount( 0 )
+{
+}
+
+void
+HeightIndex::assign( const QVector< int > & heights )
+{
+	m_heights = heights;
+	m_estimated.fill( 0, heights.size() );
+	m_estimatedCount = 0;
+
+	rebuild();
+}
+
+void
+HeightIndex::clear()
+{
+	m_heights.clear();
+	m_estimated.clear();
+	m_estimatedCount = 0;
+
+	rebuild();
+}
+
+int
+HeightIndex::count() const
+{
+	return static_cast< int > ( m_heights.size() );
+}
+
+int
+HeightIndex::height( int row ) const
+{
+	return m_heights.at( row );
+}
+
+void
+HeightIndex::setHeight( int row, int h )
+{
+	if( m_estimated.at( row ) )
+	{
+		m_estimated[ row ] = 0;
+		--m_estimatedCount;
+	}
+
+	change( row, h );
+}
+
+void
+HeightIndex::setEstimatedHeight( int row, int h )
+{
+	if( !m_estimated.at( row ) )
+	{
+		m_estimated[ row ] = 1;
+		++m_estimatedCount;
+	}
+
+	change( row, h );
+}
+
+bool
+HeightIndex::isEstimated( int row ) const
+{
+	return ( m_estimated.at( row ) != 0 );
+}
+
+int
+HeightIndex::estimatedCount() const
+{
+	return m_estimatedCount;
+}
+
+int
+HeightIndex::nextEstimated( int row ) const
+{
+	if( m_estimatedCount == 0 )
+		return -1;
+
+	const int size = count();
+
+	for( int i = qMax( row, 0 ); i < size; ++i )
+	{
+		if( m_estimated.at( i ) )
+			return i;
+	}
+
+	return -1;
+}
+
+void
+HeightIndex::insert( int row, int count )
+{
+	m_heights.insert( row, count, 0 );
+	m_estimated.insert( row, count, 0 );
+
+	rebuild();
+}
+
+void
+HeightIndex::remove( int row, int count )
+{
+	for( int i = row; i < row + count; ++i )
+	{
+		if( m_estimated.at( i ) )
+			--m_estimatedCount;
+	}
+
+	m_heights.remove( row, count );
+	m_estimated.remove( row, count );
+
+	rebuild();
+}
+
+qint64
+HeightIndex::offset( int row ) const
+{
+	qint64 sum = 0;
+
+	for( int i = row; i > 0; i -= ( i & -i ) )
+		sum += m_tree.at( i );
+
+	return sum;
+}
+
+qint64
+HeightIndex::total() const
+{
+	return offset( count() );
+}
+
+int
+HeightIndex::rowAt( qint64 y ) const
+{
+	if( y < 0 )
+		return 0;
+
+	const int size = count();
+
+	int step = 1;
+
+	while( step * 2 <= size )
+		step *= 2;
+
+	int pos = 0;
+
+	for( ; step > 0; step /= 2 )
+	{
+		if( pos + step <= size && m_tree.at( pos + step ) <= y )
+		{
+			pos += step;
+			y -= m_tree.at( pos );
+		}
+	}
+
+	return pos;
+}
+
+void
+HeightIndex::rebuild()
+{
+	const int size = count();
+
+	m_tree.fill( 0, size + 1 );
+
+	for( int i = 1; i <= size; ++i )
+	{
+		m_tree[ i ] += m_heights.at( i - 1 );
+
+		const int parent = i + ( i & -i );
+
+		if( parent <= size )
+			m_tree[ parent ] += m_tree.at( i );
+	}
+}
+
+void
+HeightIndex::change( int row, int h )
+{
+	const qint64 delta = h - m_heights.at( row );
+
+	if( delta == 0 )
+		return;
+
+	m_heights[ row ] = h;
+
+	const int size = count();
+
+	for( int i = row + 1; i <= size; i += ( i & -i ) )
+		m_tree[ i ] += delta;
+}
+
+} /* namespace QtMWidgets */
@@ -0,0 +1,93 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__PRIVATE__HEIGHTINDEX_HPP__INCLUDED
+#define QTMWIDGETS__PRIVATE__HEIGHTINDEX_HPP__INCLUDED
+
+// Qt include.
+#include <QVector>
+
+
+namespace QtMWidgets {
+
+//
+// HeightIndex
+//
+
+/*!
+	Heights of the rows with prefix sums (Fenwick tree).
+
+	Change of one row's height, offset of the row and search
+	of the row by the offset are O(log n). Insertion and removal
+	of the rows rebuild the tree in O(n) without measuring rows.
+
+	Height of the row may be marked as estimated, such rows are
+	expected to be measured later.
+*/
+class HeightIndex {
+public:
+	HeightIndex();
+
+	//! Replace all heights, all heights are exact.
+	void assign( const QVector< int > & heights );
+	//! Remove all rows.
+	void clear();
+
+	//! \return Count of rows.
+	int count() const;
+
+	//! \return Height of the \a row.
+	int height( int row ) const;
+	//! Set exact height of the \a row.
+	void setHeight( int row, int h );
+	//! Set estimated height of the \a row.
+	void setEstimatedHeight( int row, int h );
+
+	//! \return Is height of the \a row estimated.
+	bool isEstimated( int row ) const;
+	//! \return Count of rows with estimated height.
+	int estimatedCount() const;
+	/*!
+		\return First row with estimated height starting from \a row,
+		-1 if there is no such row.
+	*/
+	int nextEstimated( int row ) const;
+
+	//! Insert \a count rows of zero exact height before \a row.
+	void insert( int row, int count );
+	//! Remove \a count rows starting from \a row.
+	void remove( int row, int count );
+
+	//! \return Sum of heights of the rows before \a row.
+	qint64 offset( int row ) const;
+	//! \return Sum of heights of all rows.
+	qint64 total() const;
+
+	/*!
+		\return Row that contains the given \a y offset, count()
+		if \a y is outside of all rows.
+	*/
+	int rowAt( qint64 y ) const;
+
+private:
+	//! Build tree from heights.
+	void rebuild();
+	//! Change height of the \a row in the tree.
+	void change( int row, int h );
+
+	//! Heights.
+	QVector< int > m_heights;
+	//! Fenwick tree, 1-based.
+	QVector< qint64 > m_tree;
+	//! Is height of the row estimated.
+	QVector< char > m_estimated;
+	//! Count of rows with estimated height.
+	int m_estimatedCount;
+}; // class HeightIndex
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__PRIVATE__HEIGHTINDEX_HPP__INCLUDED
@@ -0,0 +1,280 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "idlescheduler.hpp"
+
+// Qt include.
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QTimer>
+
+
+namespace QtMWidgets {
+
+//
+// IdleJob
+//
+
+IdleJob::IdleJob( const char * name, Priority p )
+	:	m_name( name )
+	,	m_priority( p )
+	,	m_deadline( QDeadlineTimer::Forever )
+	,	m_scheduler( 0 )
+{
+}
+
+IdleJob::~IdleJob()
+{
+	if( m_scheduler )
+		m_scheduler->cancel( this );
+}
+
+const char *
+IdleJob::name() const
+{
+	return m_name;
+}
+
+IdleJob::Priority
+IdleJob::priority() const
+{
+	return m_priority;
+}
+
+void
+IdleJob::setPriority( Priority p )
+{
+	m_priority = p;
+}
+
+const QDeadlineTimer &
+IdleJob::deadline() const
+{
+	return m_deadline;
+}
+
+void
+IdleJob::setDeadline( const QDeadlineTimer & d )
+{
+	m_deadline = d;
+}
+
+const IdleJob::Stats &
+IdleJob::stats() const
+{
+	return m_stats;
+}
+
+bool
+IdleJob::isPending() const
+{
+	return ( m_scheduler != 0 );
+}
+
+void
+IdleJob::finished()
+{
+}
+
+
+//
+// IdleScheduler
+//
+
+static QPointer< IdleScheduler > s_scheduler;
+
+IdleScheduler::IdleScheduler( QObject * parent )
+	:	QObject( parent )
+	,	m_timer( new QTimer( this ) )
+	,	m_sliceDuration( 4 )
+{
+	m_timer->setSingleShot( true );
+
+	connect( m_timer, &QTimer::timeout,
+		this, &IdleScheduler::_q_runSlice );
+}
+
+IdleScheduler::~IdleScheduler()
+{
+	foreach( IdleJob * job, m_jobs )
+		job->m_scheduler = 0;
+}
+
+IdleScheduler *
+IdleScheduler::instance()
+{
+	if( !s_scheduler )
+		s_scheduler = new IdleScheduler( QCoreApplication::instance() );
+
+	return s_scheduler.data();
+}
+
+void
+IdleScheduler::post( IdleJob * job )
+{
+	if( !job )
+		return;
+
+	if( job->m_scheduler != this )
+	{
+		job->m_stats = IdleJob::Stats();
+		job->m_scheduler = this;
+		m_jobs.append( job );
+	}
+
+	schedule();
+}
+
+bool
+IdleScheduler::runSlice( IdleJob * job )
+{
+	if( !job )
+		return true;
+
+	return runJob( job, QDeadlineTimer( m_sliceDuration ) );
+}
+
+void
+IdleScheduler::finish( IdleJob * job )
+{
+	if( job )
+		runJob( job, QDeadlineTimer( QDeadlineTimer::Forever ) );
+}
+
+void
+IdleScheduler::cancel( IdleJob * job )
+{
+	if( job && job->m_scheduler == this )
+	{
+		m_jobs.removeOne( job );
+		job->m_scheduler = 0;
+	}
+}
+
+int
+IdleScheduler::pendingCount() const
+{
+	return m_jobs.size();
+}
+
+const QList< IdleJob* > &
+IdleScheduler::pendingJobs() const
+{
+	return m_jobs;
+}
+
+int
+IdleScheduler::sliceDuration() const
+{
+	return m_sliceDuration;
+}
+
+void
+IdleScheduler::setSliceDuration( int ms )
+{
+	if( ms <= 0 )
+	{
+		qWarning( "IdleScheduler::setSliceDuration(): "
+			"duration should be greater than 0." );
+
+		return;
+	}
+
+	m_sliceDuration = ms;
+}
+
+void
+IdleScheduler::setStatsHook( const StatsHook & hook )
+{
+	m_hook = hook;
+}
+
+bool
+IdleScheduler::runJob( IdleJob * job, const QDeadlineTimer & sliceEnd )
+{
+	QElapsedTimer timer;
+	timer.start();
+
+	const bool done = job->run( sliceEnd );
+
+	job->m_stats.nsecs += timer.nsecsElapsed();
+	++job->m_stats.slices;
+	job->m_stats.finished = done;
+
+	if( done )
+		cancel( job );
+
+	if( m_hook )
+		m_hook( job );
+
+	if( done )
+		job->finished();
+
+	return done;
+}
+
+IdleJob *
+IdleScheduler::nextJob() const
+{
+	IdleJob * next = 0;
+
+	foreach( IdleJob * job, m_jobs )
+	{
+		if( !next )
+			next = job;
+		else
+		{
+			const bool expired = job->deadline().hasExpired();
+			const bool nextExpired = next->deadline().hasExpired();
+
+			if( expired != nextExpired )
+			{
+				if( expired )
+					next = job;
+			}
+			else if( job->priority() != next->priority() )
+			{
+				if( job->priority() > next->priority() )
+					next = job;
+			}
+			else if( job->deadline() < next->deadline() )
+				next = job;
+		}
+	}
+
+	return next;
+}
+
+void
+IdleScheduler::schedule()
+{
+	if( !m_jobs.isEmpty() && !m_timer->isActive() )
+		m_timer->start( 0 );
+}
+
+void
+IdleScheduler::_q_runSlice()
+{
+	const QDeadlineTimer sliceEnd( m_sliceDuration );
+
+	while( !m_jobs.isEmpty() )
+	{
+		IdleJob * job = nextJob();
+
+		if( job->deadline().hasExpired() )
+			runJob( job, QDeadlineTimer( QDeadlineTimer::Forever ) );
+		else if( sliceEnd.hasExpired() )
+			break;
+		else
+			runJob( job, sliceEnd );
+	}
+
+	schedule();
+}
+
+} /* namespace QtMWidgets */
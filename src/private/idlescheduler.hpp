@@ -0,0 +1,193 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__PRIVATE__IDLESCHEDULER_HPP__INCLUDED
+#define QTMWIDGETS__PRIVATE__IDLESCHEDULER_HPP__INCLUDED
+
+// Qt include.
+#include <QObject>
+#include <QList>
+#include <QDeadlineTimer>
+
+// C++ include.
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+class QTimer;
+QT_END_NAMESPACE
+
+
+namespace QtMWidgets {
+
+class IdleScheduler;
+
+
+//
+// IdleJob
+//
+
+/*!
+	Resumable job for the IdleScheduler.
+
+	The job does its work in parts in run(), each part should not
+	take longer than the given slice allows.
+*/
+class IdleJob {
+public:
+	//! Priority of the job.
+	enum Priority {
+		//! Background work.
+		LowPriority = 0,
+		//! Default priority.
+		NormalPriority = 1,
+		//! Work visible to the user.
+		HighPriority = 2
+	}; // enum Priority
+
+	//! Statistics of the job.
+	struct Stats {
+		Stats()
+			:	slices( 0 )
+			,	nsecs( 0 )
+			,	finished( false )
+		{
+		}
+
+		//! Count of run() calls.
+		int slices;
+		//! Total time spent in run(), in nanoseconds.
+		qint64 nsecs;
+		//! Is job done?
+		bool finished;
+	}; // struct Stats
+
+	explicit IdleJob( const char * name, Priority p = NormalPriority );
+	virtual ~IdleJob();
+
+	//! \return Name of the job.
+	const char * name() const;
+
+	//! \return Priority.
+	Priority priority() const;
+	//! Set priority.
+	void setPriority( Priority p );
+
+	//! \return Deadline.
+	const QDeadlineTimer & deadline() const;
+	/*!
+		Set deadline. Job with expired deadline is finished
+		in the next slice regardless of the slice duration.
+	*/
+	void setDeadline( const QDeadlineTimer & d );
+
+	//! \return Statistics.
+	const Stats & stats() const;
+
+	//! \return Is job posted to the scheduler and not finished yet?
+	bool isPending() const;
+
+protected:
+	/*!
+		Do the next part of the work. Work should be interrupted when
+		\a sliceEnd has expired.
+
+		\return Is job done?
+	*/
+	virtual bool run( const QDeadlineTimer & sliceEnd ) = 0;
+
+	//! Called when job is done.
+	virtual void finished();
+
+private:
+	friend class IdleScheduler;
+
+	Q_DISABLE_COPY( IdleJob )
+
+	const char * m_name;
+	Priority m_priority;
+	QDeadlineTimer m_deadline;
+	Stats m_stats;
+	IdleScheduler * m_scheduler;
+}; // class IdleJob
+
+
+//
+// IdleScheduler
+//
+
+/*!
+	Cooperative scheduler of the deferred work on the GUI thread.
+
+	Posted jobs are run in slices of sliceDuration() milliseconds
+	between the events. Job with the expired deadline runs first,
+	then jobs with higher priority, then jobs with the earlier
+	deadline, then in the order of posting.
+
+	Jobs are not owned by the scheduler, the job removes itself
+	from the scheduler on destruction.
+*/
+class IdleScheduler
+	:	public QObject
+{
+	Q_OBJECT
+
+public:
+	//! Hook called after each run of the job.
+	typedef std::function< void ( const IdleJob * job ) > StatsHook;
+
+	//! \return Instance of the scheduler.
+	static IdleScheduler * instance();
+
+	//! Post \a job. Job will be run in the next slices.
+	void post( IdleJob * job );
+	/*!
+		Run one slice of the \a job right now.
+
+		\return Is job done?
+	*/
+	bool runSlice( IdleJob * job );
+	//! Run \a job right now till the end, used when result is needed.
+	void finish( IdleJob * job );
+	//! Remove \a job from the scheduler.
+	void cancel( IdleJob * job );
+
+	//! \return Count of pending jobs.
+	int pendingCount() const;
+	//! \return Pending jobs.
+	const QList< IdleJob* > & pendingJobs() const;
+
+	//! \return Duration of the slice, in milliseconds.
+	int sliceDuration() const;
+	//! Set duration of the slice, in milliseconds.
+	void setSliceDuration( int ms );
+
+	//! Set hook called after each run of the job.
+	void setStatsHook( const StatsHook & hook );
+
+private slots:
+	void _q_runSlice();
+
+private:
+	explicit IdleScheduler( QObject * parent );
+	~IdleScheduler();
+
+	//! Run \a job once. \return Is job done?
+	bool runJob( IdleJob * job, const QDeadlineTimer & sliceEnd );
+	//! \return Next job to run.
+	IdleJob * nextJob() const;
+	void schedule();
+
+	Q_DISABLE_COPY( IdleScheduler )
+
+	QList< IdleJob* > m_jobs;
+	QTimer * m_timer;
+	int m_sliceDuration;
+	StatsHook m_hook;
+}; // class IdleScheduler
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__PRIVATE__IDLESCHEDULER_HPP__INCLUDED
@@ -0,0 +1,204 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__PRIVATE__IMAGELISTVIEW_P_HPP__INCLUDED
+#define QTMWIDGETS__PRIVATE__IMAGELISTVIEW_P_HPP__INCLUDED
+
+// QtMWidgets include.
+#include "../imagelistview.hpp"
+#include "lrucache.hpp"
+
+// Qt include.
+#include <QHash>
+#include <QSet>
+#include <QMutex>
+#include <QRunnable>
+#include <QThreadPool>
+
+// C++ include.
+#include <functional>
+
+QT_BEGIN_NAMESPACE
+class QTimer;
+QT_END_NAMESPACE
+
+
+namespace QtMWidgets {
+
+//
+// ImageDecodeRequest
+//
+
+//! Request to decode the image.
+struct ImageDecodeRequest {
+	//! File name.
+	QString fileName;
+	//! Row of the file when the request was made.
+	int row;
+	//! Generation of the images when the request was made.
+	int generation;
+	//! Is only thumbnail needed?
+	bool thumbnail;
+}; // struct ImageDecodeRequest
+
+
+//
+// ImageDecodeResult
+//
+
+//! Decoded image.
+struct ImageDecodeResult {
+	//! File name.
+	QString fileName;
+	//! Row of the file when the request was made.
+	int row;
+	//! Generation of the images when the request was made.
+	int generation;
+	//! Full quality image, null if only thumbnail was requested.
+	QImage image;
+	//! Thumbnail.
+	QImage thumbnail;
+	//! Size of the image in the file.
+	QSize size;
+}; // struct ImageDecodeResult
+
+
+//
+// ImageDecoder
+//
+
+/*!
+	Decodes images on its own thread pool. Queue of the requests is
+	replaced as a whole when visible rows change, so stale requests
+	are never decoded and the first requests are decoded first.
+*/
+class ImageDecoder {
+public:
+	//! Function called on the worker thread for every decoded image.
+	typedef std::function< void ( const ImageDecodeResult & ) > Callback;
+
+	explicit ImageDecoder( const Callback & callback );
+	~ImageDecoder();
+
+	//! Set sizes of the images and thumbnails.
+	void setSizes( const QSize & imageSize, const QSize & thumbnailSize );
+	/*!
+		Replace queued requests with \a requests. Requests for the
+		files being decoded right now are skipped.
+	*/
+	void setRequests( const QVector< ImageDecodeRequest > & requests );
+	//! Drop queued requests and wait for the workers.
+	void stop();
+
+	//! Decode requests until the queue is empty, called by the worker.
+	void work();
+
+private:
+	//! Take the next request. \return false if the queue is empty.
+	bool takeRequest( ImageDecodeRequest * request,
+		QSize * imageSize, QSize * thumbnailSize );
+
+	Callback m_callback;
+	QMutex m_mutex;
+	QVector< ImageDecodeRequest > m_queue;
+	//! Files being decoded right now.
+	QSet< QString > m_inProgress;
+	QSize m_imageSize;
+	QSize m_thumbnailSize;
+	//! Count of the started workers.
+	int m_workers;
+	QThreadPool m_pool;
+}; // class ImageDecoder
+
+
+//
+// ImageDecodeWorker
+//
+
+//! Runs ImageDecoder::work() on the thread of the pool.
+class ImageDecodeWorker
+	:	public QRunnable
+{
+public:
+	explicit ImageDecodeWorker( ImageDecoder * decoder )
+		:	m_decoder( decoder )
+	{
+	}
+
+	void run() override
+	{
+		m_decoder->work();
+	}
+
+private:
+	ImageDecoder * m_decoder;
+}; // class ImageDecodeWorker
+
+
+//
+// ImageListViewPrivate
+//
+
+class ImageListViewPrivate
+	:	public AbstractListViewPrivate< QString >
+{
+public:
+	//! Thumbnail of the row.
+	struct Thumbnail {
+		//! Image.
+		QImage image;
+		//! Size of the image in the file.
+		QSize size;
+	}; // struct Thumbnail
+
+	ImageListViewPrivate( ImageListView * parent );
+	~ImageListViewPrivate();
+
+	void initView();
+
+	inline ImageListView * q_func()
+		{ return static_cast< ImageListView* > ( q ); }
+	inline const ImageListView * q_func() const
+		{ return static_cast< const ImageListView* > ( q ); }
+
+	//! \return Size of the image of the \a fileName fit into \a bounds.
+	QSize imageSize( const QString & fileName, const QSize & bounds ) const;
+	//! Request decoding of the images around the viewport later.
+	void scheduleDecoding();
+	//! Queue decoding of the images around the viewport.
+	void requestImages();
+	//! Store decoded image.
+	void imageDecoded( const ImageDecodeResult & result );
+	//! Drop all images and measure rows again.
+	void resetImages();
+	//! Drop images of the files not in the model on the next decoding.
+	void schedulePruning();
+	//! Drop images of the files not in the model.
+	void pruneImages();
+
+	//! Maximum size of the image.
+	QSize maxImageSize;
+	//! Maximum size of the thumbnail.
+	QSize thumbnailSize;
+	//! Thumbnails by file names.
+	QHash< QString, Thumbnail > thumbnails;
+	//! Bytes used by thumbnails.
+	qint64 thumbnailBytes;
+	//! Generation of the images, results of the older ones are dropped.
+	int generation;
+	//! Should images of the files not in the model be dropped?
+	bool pruneNeeded;
+	//! Full quality images by file names.
+	QScopedPointer< LruCache< QString, QImage > > images;
+	//! Timer coalescing decoding requests.
+	QTimer * decodeTimer;
+	//! Decoder.
+	QScopedPointer< ImageDecoder > decoder;
+}; // class ImageListViewPrivate
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__PRIVATE__IMAGELISTVIEW_P_HPP__INCLUDED
@@ -0,0 +1,550 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "listaccessible.hpp"
+
+// Qt include.
+#include <QTimer>
+#include <QWidget>
+
+
+namespace QtMWidgets {
+
+//! Interval in milliseconds accessibility events are coalesced for.
+static const int c_accessibleUpdateDelay = 100;
+
+#ifndef QT_NO_ACCESSIBILITY
+
+//
+// ListAccessible
+//
+
+ListAccessible::ListAccessible( QWidget * w )
+	:	QAccessibleWidget( w, QAccessible::List )
+{
+}
+
+ListAccessible::~ListAccessible()
+{
+	invalidateRows();
+}
+
+int
+ListAccessible::currentRow() const
+{
+	return -1;
+}
+
+bool
+ListAccessible::setCurrentRow( int row )
+{
+	Q_UNUSED( row )
+
+	return false;
+}
+
+QRect
+ListAccessible::screenRowRect( int row ) const
+{
+	const QRect r = rowRect( row );
+
+	if( r.isNull() )
+		return QRect();
+
+	return QRect( widget()->mapToGlobal( r.topLeft() ), r.size() );
+}
+
+void
+ListAccessible::trimRows()
+{
+	const QVector< int > visible = visibleRows();
+	const int current = currentRow();
+
+	QHash< int, QAccessible::Id >::iterator it = m_rows.begin();
+
+	while( it != m_rows.end() )
+	{
+		if( it.key() != current && !visible.contains( it.key() ) )
+		{
+			QAccessible::deleteAccessibleInterface( it.value() );
+
+			it = m_rows.erase( it );
+		}
+		else
+			++it;
+	}
+}
+
+void
+ListAccessible::invalidateRows()
+{
+	foreach( QAccessible::Id id, m_rows )
+		QAccessible::deleteAccessibleInterface( id );
+
+	m_rows.clear();
+}
+
+void *
+ListAccessible::interface_cast( QAccessible::InterfaceType t )
+{
+	if( t == QAccessible::TableInterface )
+		return static_cast< QAccessibleTableInterface* > ( this );
+
+	return QAccessibleWidget::interface_cast( t );
+}
+
+int
+ListAccessible::childCount() const
+{
+	return visibleRows().count();
+}
+
+QAccessibleInterface *
+ListAccessible::child( int index ) const
+{
+	const QVector< int > rows = visibleRows();
+
+	if( index < 0 || index >= rows.count() )
+		return 0;
+
+	return cellAt( rows.at( index ), 0 );
+}
+
+int
+ListAccessible::indexOfChild( const QAccessibleInterface * child ) const
+{
+	if( !child )
+		return -1;
+
+	const QAccessible::Id id = QAccessible::uniqueId(
+		const_cast< QAccessibleInterface* > ( child ) );
+
+	for( QHash< int, QAccessible::Id >::const_iterator it = m_rows.constBegin(),
+		last = m_rows.constEnd(); it != last; ++it )
+	{
+		if( it.value() == id )
+			return visibleRows().indexOf( it.key() );
+	}
+
+	return -1;
+}
+
+QAccessibleInterface *
+ListAccessible::childAt( int x, int y ) const
+{
+	const QPoint p = widget()->mapFromGlobal( QPoint( x, y ) );
+
+	foreach( int row, visibleRows() )
+	{
+		if( rowRect( row ).contains( p ) )
+			return cellAt( row, 0 );
+	}
+
+	return 0;
+}
+
+QAccessibleInterface *
+ListAccessible::caption() const
+{
+	return 0;
+}
+
+QAccessibleInterface *
+ListAccessible::summary() const
+{
+	return 0;
+}
+
+QAccessibleInterface *
+ListAccessible::cellAt( int row, int column ) const
+{
+	if( column != 0 || row < 0 || row >= rowCount() )
+		return 0;
+
+	QHash< int, QAccessible::Id >::const_iterator it = m_rows.constFind( row );
+
+	if( it != m_rows.constEnd() )
+		return QAccessible::accessibleInterface( it.value() );
+
+	ListRowAccessible * iface = new ListRowAccessible(
+		const_cast< ListAccessible* > ( this ), row, rowText( row ) );
+
+	m_rows.insert( row, QAccessible::registerAccessibleInterface( iface ) );
+
+	return iface;
+}
+
+int
+ListAccessible::columnCount() const
+{
+	return 1;
+}
+
+int
+ListAccessible::selectedCellCount() const
+{
+	return selectedRowCount();
+}
+
+QList< QAccessibleInterface* >
+ListAccessible::selectedCells() const
+{
+	QList< QAccessibleInterface* > cells;
+
+	QAccessibleInterface * cell = cellAt( currentRow(), 0 );
+
+	if( cell )
+		cells.append( cell );
+
+	return cells;
+}
+
+QString
+ListAccessible::columnDescription( int column ) const
+{
+	Q_UNUSED( column )
+
+	return QString();
+}
+
+QString
+ListAccessible::rowDescription( int row ) const
+{
+	Q_UNUSED( row )
+
+	return QString();
+}
+
+int
+ListAccessible::selectedColumnCount() const
+{
+	return 0;
+}
+
+int
+ListAccessible::selectedRowCount() const
+{
+	return ( currentRow() >= 0 ? 1 : 0 );
+}
+
+QList< int >
+ListAccessible::selectedColumns() const
+{
+	return QList< int > ();
+}
+
+QList< int >
+ListAccessible::selectedRows() const
+{
+	QList< int > rows;
+
+	if( currentRow() >= 0 )
+		rows.append( currentRow() );
+
+	return rows;
+}
+
+bool
+ListAccessible::isColumnSelected( int column ) const
+{
+	Q_UNUSED( column )
+
+	return false;
+}
+
+bool
+ListAccessible::isRowSelected( int row ) const
+{
+	return ( row >= 0 && row == currentRow() );
+}
+
+bool
+ListAccessible::selectRow( int row )
+{
+	if( row < 0 || row >= rowCount() )
+		return false;
+
+	return setCurrentRow( row );
+}
+
+bool
+ListAccessible::selectColumn( int column )
+{
+	Q_UNUSED( column )
+
+	return false;
+}
+
+bool
+ListAccessible::unselectRow( int row )
+{
+	Q_UNUSED( row )
+
+	return false;
+}
+
+bool
+ListAccessible::unselectColumn( int column )
+{
+	Q_UNUSED( column )
+
+	return false;
+}
+
+void
+ListAccessible::modelChange( QAccessibleTableModelChangeEvent * event )
+{
+	Q_UNUSED( event )
+
+	// Rows may be shifted, texts are cached, so all rows are dropped.
+	invalidateRows();
+}
+
+
+//
+// ListRowAccessible
+//
+
+ListRowAccessible::ListRowAccessible( ListAccessible * list, int row,
+	const QString & text )
+	:	m_list( list )
+	,	m_row( row )
+	,	m_text( text )
+{
+}
+
+bool
+ListRowAccessible::isValid() const
+{
+	return ( m_list->isValid() && m_row < m_list->rowCount() );
+}
+
+QObject *
+ListRowAccessible::object() const
+{
+	return 0;
+}
+
+QWindow *
+ListRowAccessible::window() const
+{
+	return m_list->window();
+}
+
+QAccessibleInterface *
+ListRowAccessible::childAt( int x, int y ) const
+{
+	Q_UNUSED( x )
+	Q_UNUSED( y )
+
+	return 0;
+}
+
+QAccessibleInterface *
+ListRowAccessible::parent() const
+{
+	return m_list;
+}
+
+QAccessibleInterface *
+ListRowAccessible::child( int index ) const
+{
+	Q_UNUSED( index )
+
+	return 0;
+}
+
+int
+ListRowAccessible::childCount() const
+{
+	return 0;
+}
+
+int
+ListRowAccessible::indexOfChild( const QAccessibleInterface * child ) const
+{
+	Q_UNUSED( child )
+
+	return -1;
+}
+
+QString
+ListRowAccessible::text( QAccessible::Text t ) const
+{
+	return ( t == QAccessible::Name ? m_text : QString() );
+}
+
+void
+ListRowAccessible::setText( QAccessible::Text t, const QString & text )
+{
+	Q_UNUSED( t )
+	Q_UNUSED( text )
+}
+
+QRect
+ListRowAccessible::rect() const
+{
+	return m_list->screenRowRect( m_row );
+}
+
+QAccessible::Role
+ListRowAccessible::role() const
+{
+	return QAccessible::ListItem;
+}
+
+QAccessible::State
+ListRowAccessible::state() const
+{
+	QAccessible::State s;
+	s.selectable = true;
+	s.selected = isSelected();
+
+	if( m_list->rowRect( m_row ).isNull() )
+	{
+		s.invisible = true;
+		s.offscreen = true;
+	}
+
+	return s;
+}
+
+void *
+ListRowAccessible::interface_cast( QAccessible::InterfaceType t )
+{
+	if( t == QAccessible::TableCellInterface )
+		return static_cast< QAccessibleTableCellInterface* > ( this );
+
+	return 0;
+}
+
+bool
+ListRowAccessible::isSelected() const
+{
+	return m_list->isRowSelected( m_row );
+}
+
+QList< QAccessibleInterface* >
+ListRowAccessible::columnHeaderCells() const
+{
+	return QList< QAccessibleInterface* > ();
+}
+
+QList< QAccessibleInterface* >
+ListRowAccessible::rowHeaderCells() const
+{
+	return QList< QAccessibleInterface* > ();
+}
+
+int
+ListRowAccessible::columnIndex() const
+{
+	return 0;
+}
+
+int
+ListRowAccessible::rowIndex() const
+{
+	return m_row;
+}
+
+int
+ListRowAccessible::columnExtent() const
+{
+	return 1;
+}
+
+int
+ListRowAccessible::rowExtent() const
+{
+	return 1;
+}
+
+QAccessibleInterface *
+ListRowAccessible::table() const
+{
+	return m_list;
+}
+
+#endif // QT_NO_ACCESSIBILITY
+
+
+//
+// AccessibleUpdates
+//
+
+AccessibleUpdates::AccessibleUpdates( QWidget * widget )
+	:	QObject( widget )
+	,	m_widget( widget )
+	,	m_timer( new QTimer( this ) )
+	,	m_changes( 0 )
+{
+	m_timer->setSingleShot( true );
+	m_timer->setInterval( c_accessibleUpdateDelay );
+
+	connect( m_timer, &QTimer::timeout, this, &AccessibleUpdates::flush );
+}
+
+void
+AccessibleUpdates::post( QWidget * widget, Change change )
+{
+#ifndef QT_NO_ACCESSIBILITY
+	// Nobody listens, no need to track anything.
+	if( !QAccessible::isActive() )
+		return;
+
+	AccessibleUpdates * updates = widget->findChild< AccessibleUpdates* > (
+		QString(), Qt::FindDirectChildrenOnly );
+
+	if( !updates )
+		updates = new AccessibleUpdates( widget );
+
+	updates->m_changes |= change;
+
+	if( !updates->m_timer->isActive() )
+		updates->m_timer->start();
+#else
+	Q_UNUSED( widget )
+	Q_UNUSED( change )
+#endif
+}
+
+void
+AccessibleUpdates::flush()
+{
+	const int changes = m_changes;
+
+	m_changes = 0;
+
+#ifndef QT_NO_ACCESSIBILITY
+	if( !QAccessible::isActive() )
+		return;
+
+	if( changes & ModelChanged )
+	{
+		// ListAccessible drops its rows in modelChange().
+		QAccessibleTableModelChangeEvent event( m_widget,
+			QAccessibleTableModelChangeEvent::ModelReset );
+		QAccessible::updateAccessibility( &event );
+	}
+	else if( changes & Scrolled )
+	{
+		ListAccessible * list = dynamic_cast< ListAccessible* > (
+			QAccessible::queryAccessibleInterface( m_widget ) );
+
+		if( list )
+			list->trimRows();
+
+		QAccessibleEvent event( m_widget, QAccessible::VisibleDataChanged );
+		QAccessible::updateAccessibility( &event );
+	}
+#else
+	Q_UNUSED( changes )
+#endif
+}
+
+} /* namespace QtMWidgets */
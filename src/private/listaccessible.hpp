@@ -0,0 +1,188 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__PRIVATE__LISTACCESSIBLE_HPP__INCLUDED
+#define QTMWIDGETS__PRIVATE__LISTACCESSIBLE_HPP__INCLUDED
+
+// Qt include.
+#include <QObject>
+#include <QHash>
+#include <QVector>
+
+#ifndef QT_NO_ACCESSIBILITY
+#include <QAccessible>
+#include <QAccessibleWidget>
+#endif
+
+QT_BEGIN_NAMESPACE
+class QTimer;
+class QWidget;
+QT_END_NAMESPACE
+
+
+namespace QtMWidgets {
+
+#ifndef QT_NO_ACCESSIBILITY
+
+//
+// ListAccessible
+//
+
+/*!
+	Accessible interface of the list with huge count of rows.
+
+	Only visible rows are children of the list, interfaces of the
+	rows are created on demand with cached text and are dropped when
+	rows are scrolled away or the model changed. Count of all rows is
+	available through the table interface without creating the rows.
+*/
+class ListAccessible
+	:	public QAccessibleWidget
+	,	public QAccessibleTableInterface
+{
+public:
+	explicit ListAccessible( QWidget * w );
+	~ListAccessible() override;
+
+	//! \return Count of all rows.
+	int rowCount() const override = 0;
+	//! \return Visible rows in the visual order.
+	virtual QVector< int > visibleRows() const = 0;
+	//! \return Rectangle of the \a row in the widget, null if it's not visible.
+	virtual QRect rowRect( int row ) const = 0;
+	//! \return Text of the \a row.
+	virtual QString rowText( int row ) const = 0;
+	//! \return Current row, -1 if there is no current row.
+	virtual int currentRow() const;
+	//! Make \a row current. \return Is current row changed?
+	virtual bool setCurrentRow( int row );
+
+	//! \return Rectangle of the \a row on the screen.
+	QRect screenRowRect( int row ) const;
+	//! Drop interfaces of the rows that are not visible anymore.
+	void trimRows();
+	//! Drop interfaces of all rows.
+	void invalidateRows();
+
+	void * interface_cast( QAccessible::InterfaceType t ) override;
+	int childCount() const override;
+	QAccessibleInterface * child( int index ) const override;
+	int indexOfChild( const QAccessibleInterface * child ) const override;
+	QAccessibleInterface * childAt( int x, int y ) const override;
+
+	QAccessibleInterface * caption() const override;
+	QAccessibleInterface * summary() const override;
+	QAccessibleInterface * cellAt( int row, int column ) const override;
+	int columnCount() const override;
+	int selectedCellCount() const override;
+	QList< QAccessibleInterface* > selectedCells() const override;
+	QString columnDescription( int column ) const override;
+	QString rowDescription( int row ) const override;
+	int selectedColumnCount() const override;
+	int selectedRowCount() const override;
+	QList< int > selectedColumns() const override;
+	QList< int > selectedRows() const override;
+	bool isColumnSelected( int column ) const override;
+	bool isRowSelected( int row ) const override;
+	bool selectRow( int row ) override;
+	bool selectColumn( int column ) override;
+	bool unselectRow( int row ) override;
+	bool unselectColumn( int column ) override;
+	void modelChange( QAccessibleTableModelChangeEvent * event ) override;
+
+private:
+	//! Ids of the created interfaces of the rows.
+	mutable QHash< int, QAccessible::Id > m_rows;
+}; // class ListAccessible
+
+
+//
+// ListRowAccessible
+//
+
+//! Accessible interface of the row of ListAccessible.
+class ListRowAccessible
+	:	public QAccessibleInterface
+	,	public QAccessibleTableCellInterface
+{
+public:
+	ListRowAccessible( ListAccessible * list, int row, const QString & text );
+
+	bool isValid() const override;
+	QObject * object() const override;
+	QWindow * window() const override;
+	QAccessibleInterface * childAt( int x, int y ) const override;
+	QAccessibleInterface * parent() const override;
+	QAccessibleInterface * child( int index ) const override;
+	int childCount() const override;
+	int indexOfChild( const QAccessibleInterface * child ) const override;
+	QString text( QAccessible::Text t ) const override;
+	void setText( QAccessible::Text t, const QString & text ) override;
+	QRect rect() const override;
+	QAccessible::Role role() const override;
+	QAccessible::State state() const override;
+	void * interface_cast( QAccessible::InterfaceType t ) override;
+
+	bool isSelected() const override;
+	QList< QAccessibleInterface* > columnHeaderCells() const override;
+	QList< QAccessibleInterface* > rowHeaderCells() const override;
+	int columnIndex() const override;
+	int rowIndex() const override;
+	int columnExtent() const override;
+	int rowExtent() const override;
+	QAccessibleInterface * table() const override;
+
+private:
+	ListAccessible * m_list;
+	int m_row;
+	//! Cached text of the row.
+	QString m_text;
+}; // class ListRowAccessible
+
+#endif // QT_NO_ACCESSIBILITY
+
+
+//
+// AccessibleUpdates
+//
+
+/*!
+	Coalesces accessibility events of the list widget, so scrolling
+	and bursts of model changes send one event per interval. Does
+	nothing while assistive technology is not active.
+*/
+class AccessibleUpdates
+	:	public QObject
+{
+	Q_OBJECT
+
+public:
+	//! Kind of the change.
+	enum Change {
+		//! Visible rows changed.
+		Scrolled = 1,
+		//! Rows of the model changed.
+		ModelChanged = 2
+	}; // enum Change
+
+	//! Remember \a change of the \a widget, event will be sent later.
+	static void post( QWidget * widget, Change change );
+
+private slots:
+	//! Send event about the collected changes.
+	void flush();
+
+private:
+	explicit AccessibleUpdates( QWidget * widget );
+
+	QWidget * m_widget;
+	QTimer * m_timer;
+	int m_changes;
+}; // class AccessibleUpdates
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__PRIVATE__LISTACCESSIBLE_HPP__INCLUDED
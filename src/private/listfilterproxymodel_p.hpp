@@ -0,0 +1,122 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__PRIVATE__LISTFILTERPROXYMODEL_P_HPP__INCLUDED
+#define QTMWIDGETS__PRIVATE__LISTFILTERPROXYMODEL_P_HPP__INCLUDED
+
+// Qt include.
+#include <QList>
+#include <QVector>
+#include <QRunnable>
+#include <QAtomicInt>
+#include <QSharedPointer>
+
+// C++ include.
+#include <functional>
+
+
+namespace QtMWidgets {
+
+//! Less rows are filtered in the GUI thread.
+static const int c_minParallelFilterRows = 4096;
+
+//! Minimum count of rows in the one chunk of the filter.
+static const int c_minFilterChunkRows = 2048;
+
+//! Rows between checks of cancellation of the filter.
+static const int c_filterCancelCheckRows = 1024;
+
+//! More runs of changed rows are reported as model reset.
+static const int c_maxIncrementalFilterRuns = 64;
+
+
+//
+// ListFilterJob
+//
+
+//! One query of the ListFilterProxyModel.
+template< typename T >
+class ListFilterJob {
+public:
+	ListFilterJob()
+		:	all( true )
+		,	refines( false )
+		,	pending( 0 )
+		,	cancelled( 0 )
+	{
+	}
+
+	//! Snapshot of the source data.
+	QList< T > data;
+	//! Predicate.
+	std::function< bool ( const T & ) > predicate;
+	//! Source rows to check if not all.
+	QVector< int > candidates;
+	//! Should all rows be checked?
+	bool all;
+	//! Is it refinement of the previous query?
+	bool refines;
+	//! Accepted source rows of each chunk.
+	QVector< QVector< int > > results;
+	//! Count of not finished chunks.
+	QAtomicInt pending;
+	//! Is query stale?
+	QAtomicInt cancelled;
+}; // class ListFilterJob
+
+
+//
+// ListFilterChunk
+//
+
+//! Evaluates predicate on the part of the rows in the worker thread.
+template< typename T >
+class ListFilterChunk
+	:	public QRunnable
+{
+public:
+	ListFilterChunk( const QSharedPointer< ListFilterJob< T > > & job,
+		QVector< int > * result, int begin, int end,
+		const std::function< void () > & done )
+		:	m_job( job )
+		,	m_result( result )
+		,	m_begin( begin )
+		,	m_end( end )
+		,	m_done( done )
+	{
+	}
+
+	void run() override
+	{
+		const ListFilterJob< T > * job = m_job.data();
+
+		for( int i = m_begin; i < m_end; ++i )
+		{
+			if( ( i - m_begin ) % c_filterCancelCheckRows == 0 &&
+				job->cancelled.loadRelaxed() )
+					return;
+
+			const int row = ( job->all ? i : job->candidates.at( i ) );
+
+			if( job->predicate( job->data.at( row ) ) )
+				m_result->append( row );
+		}
+
+		if( !m_job->pending.deref() && !job->cancelled.loadRelaxed() )
+			m_done();
+	}
+
+private:
+	QSharedPointer< ListFilterJob< T > > m_job;
+	QVector< int > * m_result;
+	int m_begin;
+	int m_end;
+	std::function< void () > m_done;
+}; // class ListFilterChunk
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__PRIVATE__LISTFILTERPROXYMODEL_P_HPP__INCLUDED
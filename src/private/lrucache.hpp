@@ -0,0 +1,248 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__LRUCACHE_HPP__INCLUDED
+#define QTMWIDGETS__LRUCACHE_HPP__INCLUDED
+
+// QtMWidgets include.
+#include "../cacheregistry.hpp"
+
+// Qt include.
+#include <QHash>
+#include <QMap>
+
+
+namespace QtMWidgets {
+
+//
+// LruCache
+//
+
+/*!
+	LRU cache of the objects with the own byte budget, that
+	respects global budget of the CacheRegistry.
+
+	Interface is similar to QCache: cache owns inserted objects,
+	pointer returned by object() is valid until next insert().
+*/
+template< typename Key, typename T >
+class LruCache
+	:	public AbstractCache
+{
+public:
+	LruCache( const QString & name, qint64 maxBytes, int weight = 1 )
+		:	AbstractCache( name, weight )
+		,	m_maxBytes( maxBytes )
+		,	m_usedBytes( 0 )
+		,	m_hits( 0 )
+		,	m_misses( 0 )
+	{
+	}
+
+	~LruCache()
+	{
+		removeAll();
+	}
+
+	//! \return Cached object or 0. Marks object as recently used.
+	T * object( const Key & key )
+	{
+		typename QHash< Key, Node >::iterator it = m_items.find( key );
+
+		if( it == m_items.end() )
+		{
+			++m_misses;
+
+			return 0;
+		}
+
+		++m_hits;
+
+		m_order.remove( it->stamp );
+		it->stamp = CacheRegistry::tick();
+		m_order.insert( it->stamp, key );
+
+		return it->object;
+	}
+
+	//! \return Is object with the given key in the cache. Doesn't touch it.
+	bool contains( const Key & key ) const
+	{
+		return m_items.contains( key );
+	}
+
+	/*!
+		Insert object, cache takes ownership.
+
+		\return false if the object doesn't fit the budget, object
+		is deleted then.
+	*/
+	bool insert( const Key & key, T * object, qint64 cost )
+	{
+		remove( key );
+
+		if( cost > m_maxBytes )
+		{
+			delete object;
+
+			return false;
+		}
+
+		while( m_usedBytes + cost > m_maxBytes )
+			evictOldest();
+
+		if( !CacheRegistry::makeRoom( cost ) )
+		{
+			delete object;
+
+			return false;
+		}
+
+		Node n;
+		n.object = object;
+		n.cost = cost;
+		n.stamp = CacheRegistry::tick();
+
+		m_items.insert( key, n );
+		m_order.insert( n.stamp, key );
+		m_usedBytes += cost;
+
+		return true;
+	}
+
+	/*!
+		Move object from the \a from key to the \a to key keeping its
+		recency. Object cached with the \a to key is removed.
+	*/
+	void rename( const Key & from, const Key & to )
+	{
+		typename QHash< Key, Node >::iterator it = m_items.find( from );
+
+		if( it == m_items.end() || from == to )
+			return;
+
+		const Node n = it.value();
+
+		m_items.erase( it );
+		remove( to );
+
+		m_items.insert( to, n );
+		m_order.insert( n.stamp, to );
+	}
+
+	//! \return Keys of the cached objects in arbitrary order.
+	QList< Key > keys() const
+	{
+		return m_items.keys();
+	}
+
+	//! Remove object with the given key.
+	void remove( const Key & key )
+	{
+		typename QHash< Key, Node >::iterator it = m_items.find( key );
+
+		if( it == m_items.end() )
+			return;
+
+		m_order.remove( it->stamp );
+		m_usedBytes -= it->cost;
+		delete it->object;
+		m_items.erase( it );
+	}
+
+	//! \return Byte budget of this cache.
+	qint64 maxBytes() const
+	{
+		return m_maxBytes;
+	}
+
+	//! Set byte budget of this cache, evicts objects if needed.
+	void setMaxBytes( qint64 bytes )
+	{
+		m_maxBytes = qMax( Q_INT64_C( 0 ), bytes );
+
+		while( m_usedBytes > m_maxBytes )
+			evictOldest();
+	}
+
+	//! Reset hits and misses counters.
+	void resetStatistics()
+	{
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	qint64 usedBytes() const override
+	{
+		return m_usedBytes;
+	}
+
+	int count() const override
+	{
+		return static_cast< int > ( m_items.size() );
+	}
+
+	qint64 hits() const override
+	{
+		return m_hits;
+	}
+
+	qint64 misses() const override
+	{
+		return m_misses;
+	}
+
+	quint64 oldestAccess() const override
+	{
+		return ( m_order.isEmpty() ? 0 : m_order.firstKey() );
+	}
+
+	void evictOldest() override
+	{
+		if( !m_order.isEmpty() )
+		{
+			const Key key = m_order.first();
+
+			remove( key );
+		}
+	}
+
+	void clear() override
+	{
+		removeAll();
+	}
+
+private:
+	void removeAll()
+	{
+		foreach( const Node & n, m_items )
+			delete n.object;
+
+		m_items.clear();
+		m_order.clear();
+		m_usedBytes = 0;
+	}
+
+	//! Cached object.
+	struct Node {
+		T * object;
+		qint64 cost;
+		quint64 stamp;
+	}; // struct Node
+
+	//! Objects.
+	QHash< Key, Node > m_items;
+	//! Keys ordered by access stamp, the first is least recently used.
+	QMap< quint64, Key > m_order;
+	qint64 m_maxBytes;
+	qint64 m_usedBytes;
+	qint64 m_hits;
+	qint64 m_misses;
+}; // class LruCache
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__LRUCACHE_HPP__INCLUDED
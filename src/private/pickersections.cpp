@@ -0,0 +1,318 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "pickersections.hpp"
+#include "../color.hpp"
+#include "../renderingquality.hpp"
+
+// Qt include.
+#include <QWidget>
+#include <QPainter>
+#include <QStyleOption>
+#include <QLinearGradient>
+#include <QStringList>
+
+
+namespace QtMWidgets {
+
+//
+// PickerSectionsStyleTokens
+//
+
+void
+PickerSectionsStyleTokens::resolve( const QWidget * widget )
+{
+	StyleTokens::resolve( widget );
+
+	static const int alpha = 150;
+
+	baseColor = option.palette.color( QPalette::Dark );
+	textColor = option.palette.color( QPalette::WindowText );
+	dimmedTextColor = lighterColor( textColor, 75 );
+	cylinder = CylinderBrushes( baseColor );
+
+	windowLineColor = baseColor;
+	windowLineColor.setAlpha( 255 );
+
+	windowLightLineColor = lighterColor( baseColor, 110 );
+	windowLightLineColor.setAlpha( 255 );
+
+	QColor c3 = lighterColor( baseColor, 95 );
+	c3.setAlpha( alpha );
+
+	QColor c4 = lighterColor( baseColor, 50 );
+	c4.setAlpha( alpha );
+
+	if( RenderingQuality::gradients() )
+	{
+		QLinearGradient g( QPointF( 0.0, 0.0 ), QPointF( 0.0, 1.0 ) );
+		g.setCoordinateMode( QGradient::ObjectBoundingMode );
+		g.setColorAt( 0.0, c3 );
+		g.setColorAt( 1.0, c4 );
+
+		windowTopBrush = QBrush( g );
+	}
+	else
+		windowTopBrush = QBrush( c3 );
+
+	QColor c5 = lighterColor( baseColor, 35 );
+	c5.setAlpha( alpha );
+
+	windowBottomBrush = QBrush( c5 );
+}
+
+
+//
+// PickerSections
+//
+
+PickerSections::PickerSections( QWidget * w, QVector< Section > & s )
+	:	widget( w )
+	,	sections( s )
+	,	itemHeight( 0 )
+	,	itemTopMargin( 0 )
+	,	itemsMaxCount( 5 )
+	,	itemSideMargin( 5 )
+	,	widgetHeight( 0 )
+	,	currentItemY( 0 )
+	,	movableSection( -1 )
+{
+}
+
+void
+PickerSections::computeItemsGeometry( const QStyleOption & opt )
+{
+	itemHeight = opt.fontMetrics.boundingRect( QLatin1String( "AM" ) )
+		.height();
+
+	itemTopMargin = itemHeight / 3;
+
+	widgetHeight = itemHeight * itemsMaxCount +
+		( itemsMaxCount - 1 ) * itemTopMargin;
+
+	currentItemY = widgetHeight / 2 - itemHeight / 2;
+}
+
+int
+PickerSections::sectionX( int section ) const
+{
+	int x = 0;
+
+	for( int i = 0; i < section; ++i )
+		x += sections.at( i ).sectionWidth;
+
+	return x;
+}
+
+static inline int prevIndex( int current, int size )
+{
+	if( current == 0 )
+		return size - 1;
+	else
+		return current - 1;
+}
+
+static inline int nextIndex( int current, int size )
+{
+	if( current == size - 1 )
+		return 0;
+	else
+		return current + 1;
+}
+
+void
+PickerSections::normalizeOffset( int section )
+{
+	const int sectionValuesSize = sections.at( section ).values.size();
+	const int totalItemHeight = itemHeight + itemTopMargin;
+
+	if( sectionValuesSize == 0 || totalItemHeight == 0 )
+	{
+		sections[ section ].offset = 0;
+		return;
+	}
+
+	while( qAbs( sections.at( section ).offset ) > totalItemHeight / 2 )
+	{
+		if( sections.at( section ).offset > 0 )
+		{
+			if( sectionValuesSize < itemsMaxCount &&
+				sections[ section ].currentIndex == 0 )
+			{
+				sections[ section ].offset = 0;
+				break;
+			}
+
+			sections[ section ].offset -= totalItemHeight;
+			sections[ section ].currentIndex = prevIndex(
+				sections.at( section ).currentIndex, sectionValuesSize );
+		}
+		else
+		{
+			if( sectionValuesSize < itemsMaxCount &&
+				sections[ section ].currentIndex ==
+					sections[ section ].values.size() - 1 )
+			{
+				sections[ section ].offset = 0;
+				break;
+			}
+
+			sections[ section ].offset += totalItemHeight;
+			sections[ section ].currentIndex = nextIndex(
+				sections.at( section ).currentIndex, sectionValuesSize );
+		}
+	}
+}
+
+void
+PickerSections::normalizeOffsets()
+{
+	for( int i = 0; i < sections.size(); ++i )
+		normalizeOffset( i );
+}
+
+void
+PickerSections::drawSectionItems( int section, QPainter * p )
+{
+	if( sections.at( section ).values.isEmpty() )
+		return;
+
+	const int x = sectionX( section ) + 3 + itemSideMargin;
+
+	p->setPen( tokens.textColor );
+
+	const int yOffset = sections.at( section ).offset;
+
+	int makePrevIndexCount = itemsMaxCount / 2;
+
+	if( yOffset > 0 )
+		++makePrevIndexCount;
+
+	if( sections.at( section ).values.size() < itemsMaxCount )
+		makePrevIndexCount = sections.at( section ).currentIndex;
+
+	int index = sections.at( section ).currentIndex;
+	int y = currentItemY + yOffset;
+
+	for( int i = 0; i < makePrevIndexCount; ++i )
+	{
+		index = prevIndex( index, sections.at( section ).values.size() );
+		y -= ( itemHeight + itemTopMargin );
+	}
+
+	int iterationsCount = ( yOffset == 0 ) ? itemsMaxCount : itemsMaxCount + 1;
+
+	if( sections.at( section ).values.size() < itemsMaxCount )
+		iterationsCount = sections.at( section ).values.size();
+
+	const int textWidth = sections.at( section ).sectionWidth - 6 -
+		itemSideMargin * 2;
+
+	Section::Type type = sections.at( section ).type;
+
+	for( int i = 0; i < iterationsCount; ++i )
+	{
+		const QRect r( x, y, textWidth, itemHeight );
+
+		const QString text = sections.at( section ).values.at( index );
+
+		if( type == Section::DaySectionShort ||
+			type == Section::DaySectionLong )
+		{
+			QStringList values = text.split( QLatin1Char( ' ' ) );
+
+			p->setPen( tokens.dimmedTextColor );
+			p->drawText( r, Qt::AlignLeft | Qt::TextSingleLine, values.at( 0 ) );
+
+			p->setPen( tokens.textColor );
+			p->drawText( r, Qt::AlignRight | Qt::TextSingleLine, values.at( 1 ) );
+		}
+		else
+			p->drawText( r, Qt::AlignLeft | Qt::TextSingleLine, text );
+
+		index = nextIndex( index, sections.at( section ).values.size() );
+		y += itemHeight + itemTopMargin;
+	}
+}
+
+void
+PickerSections::drawWindow( QPainter * p, const QStyleOption & opt )
+{
+	const int windowOffset = itemHeight / 4;
+	const int windowHeight = itemHeight + windowOffset * 2;
+	const int windowMiddleHeight = windowHeight / 2;
+
+	int yTop = currentItemY - windowOffset;
+	int yBottom = yTop + windowMiddleHeight * 2;
+
+	p->setPen( tokens.windowLineColor );
+
+	p->drawLine( 0, yTop, opt.rect.width(), yTop );
+	p->drawLine( 0, yBottom, opt.rect.width(), yBottom );
+
+	p->setPen( tokens.windowLightLineColor );
+
+	p->drawLine( 0, yTop + 1, opt.rect.width(), yTop + 2 );
+
+	p->setPen( Qt::NoPen );
+	p->setBrush( tokens.windowTopBrush );
+
+	p->drawRect( 0, yTop + 2, opt.rect.width(), windowMiddleHeight - 2 );
+
+	p->setBrush( tokens.windowBottomBrush );
+	p->drawRect( 0, yTop + windowMiddleHeight,
+		opt.rect.width(), windowMiddleHeight );
+}
+
+void
+PickerSections::findMovableSection( const QPointF & pos )
+{
+	const int x = pos.x();
+
+	int width = 0;
+
+	for( int i = 0; i < sections.size(); ++i )
+	{
+		if( x >= width && x < width + sections.at( i ).sectionWidth )
+		{
+			movableSection = i;
+			return;
+		}
+
+		width += sections.at( i ).sectionWidth;
+	}
+
+	movableSection = -1;
+}
+
+void
+PickerSections::updateOffset( int delta )
+{
+	if( movableSection != -1 )
+		sections[ movableSection ].offset += delta;
+}
+
+void
+PickerSections::clearOffset()
+{
+	if( movableSection != -1 )
+		sections[ movableSection ].offset = 0;
+}
+
+const PickerSectionsStyleTokens &
+PickerSections::styleTokens()
+{
+	if( !tokens.isValid() )
+		tokens.resolve( widget );
+
+	tokens.updateState( widget );
+	tokens.option.rect = widget->rect();
+
+	return tokens;
+}
+
+} /* namespace QtMWidgets */
@@ -0,0 +1,111 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__PICKERSECTIONS_HPP__INCLUDED
+#define QTMWIDGETS__PICKERSECTIONS_HPP__INCLUDED
+
+// QtMWidgets include.
+#include "datetimeparser.hpp"
+#include "drawing.hpp"
+#include "styletokens.hpp"
+
+// Qt include.
+#include <QVector>
+#include <QPointF>
+
+QT_BEGIN_NAMESPACE
+class QPainter;
+class QStyleOption;
+class QWidget;
+QT_END_NAMESPACE
+
+
+namespace QtMWidgets {
+
+//
+// PickerSectionsStyleTokens
+//
+
+//! Colors and brushes of the cylinders and of the window.
+class PickerSectionsStyleTokens
+	:	public StyleTokens
+{
+public:
+	//! Resolve colors and brushes.
+	void resolve( const QWidget * widget );
+
+	//! Base color of the cylinders.
+	QColor baseColor;
+	//! Color of the text.
+	QColor textColor;
+	//! Color of the secondary text, i.e. day of week.
+	QColor dimmedTextColor;
+	//! Brushes of the cylinders.
+	CylinderBrushes cylinder;
+	//! Color of the window's borders.
+	QColor windowLineColor;
+	//! Color of the window's highlighted line.
+	QColor windowLightLineColor;
+	//! Brush of the upper half of the window.
+	QBrush windowTopBrush;
+	//! Brush of the lower half of the window.
+	QBrush windowBottomBrush;
+}; // class PickerSectionsStyleTokens
+
+
+//
+// PickerSections
+//
+
+/*!
+	Geometry, offsets and painting of the cylinders shown side by side
+	in one widget. Used by DateTimePicker and MultiPicker.
+*/
+class PickerSections {
+public:
+	PickerSections( QWidget * widget, QVector< Section > & sections );
+
+	//! Compute geometry of the items for the given \a opt.
+	void computeItemsGeometry( const QStyleOption & opt );
+	//! \return X coordinate of the given \a section.
+	int sectionX( int section ) const;
+
+	//! Normalize offset of the section, i.e. change current index.
+	void normalizeOffset( int section );
+	//! Normalize offsets of all sections.
+	void normalizeOffsets();
+	//! Draw items of the given \a section.
+	void drawSectionItems( int section, QPainter * p );
+	//! Draw window of the current items.
+	void drawWindow( QPainter * p, const QStyleOption & opt );
+	//! Find section under the given \a pos.
+	void findMovableSection( const QPointF & pos );
+	//! Update offset of the movable section.
+	void updateOffset( int delta );
+	//! Clear offset of the movable section.
+	void clearOffset();
+	//! \return Resolved style tokens.
+	const PickerSectionsStyleTokens & styleTokens();
+
+	//! Widget.
+	QWidget * widget;
+	//! Sections.
+	QVector< Section > & sections;
+	int itemHeight;
+	int itemTopMargin;
+	int itemsMaxCount; // Must be odd.
+	int itemSideMargin;
+	int widgetHeight;
+	int currentItemY;
+	//! Section under the mouse, or -1.
+	int movableSection;
+	//! Style tokens.
+	PickerSectionsStyleTokens tokens;
+}; // class PickerSections
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__PICKERSECTIONS_HPP__INCLUDED
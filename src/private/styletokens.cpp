@@ -0,0 +1,88 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "styletokens.hpp"
+
+// Qt include.
+#include <QEvent>
+#include <QWidget>
+
+
+namespace QtMWidgets {
+
+//
+// StyleTokens
+//
+
+StyleTokens::StyleTokens()
+	:	valid( false )
+	,	level( RenderingQuality::Full )
+{
+}
+
+bool
+StyleTokens::isValid() const
+{
+	return ( valid && level == RenderingQuality::level() );
+}
+
+void
+StyleTokens::invalidate()
+{
+	valid = false;
+}
+
+void
+StyleTokens::resolve( const QWidget * widget )
+{
+	option.initFrom( widget );
+
+	valid = true;
+	level = RenderingQuality::level();
+}
+
+void
+StyleTokens::updateState( const QWidget * widget )
+{
+	option.state &= ~( QStyle::State_HasFocus | QStyle::State_MouseOver |
+		QStyle::State_KeyboardFocusChange | QStyle::State_Active );
+
+	if( widget->hasFocus() )
+		option.state |= QStyle::State_HasFocus;
+
+	if( widget->underMouse() )
+		option.state |= QStyle::State_MouseOver;
+
+	const QWidget * window = widget->window();
+
+	if( window->testAttribute( Qt::WA_KeyboardFocusChange ) )
+		option.state |= QStyle::State_KeyboardFocusChange;
+
+	if( window->isActiveWindow() )
+		option.state |= QStyle::State_Active;
+}
+
+bool
+StyleTokens::isInvalidatedBy( const QEvent * event )
+{
+	switch( event->type() )
+	{
+		case QEvent::PaletteChange :
+		case QEvent::FontChange :
+		case QEvent::StyleChange :
+		case QEvent::LayoutDirectionChange :
+		// Color group of the resolved palette depends on these.
+		case QEvent::EnabledChange :
+		case QEvent::ActivationChange :
+			return true;
+
+		default :
+			return false;
+	}
+}
+
+} /* namespace QtMWidgets */
@@ -0,0 +1,66 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__STYLETOKENS_HPP__INCLUDED
+#define QTMWIDGETS__STYLETOKENS_HPP__INCLUDED
+
+// QtMWidgets include.
+#include "../renderingquality.hpp"
+
+// Qt include.
+#include <QStyleOption>
+
+QT_BEGIN_NAMESPACE
+class QEvent;
+class QWidget;
+QT_END_NAMESPACE
+
+
+namespace QtMWidgets {
+
+//
+// StyleTokens
+//
+
+/*!
+	Values resolved from the palette, font and style of the widget.
+
+	Widgets derive their own token blocks with precomputed colors, pens
+	and brushes, resolve them once and paint only from them. Tokens are
+	invalidated by the widget's changeEvent() and by its color setters,
+	and become obsolete when RenderingQuality level changes.
+*/
+class StyleTokens {
+public:
+	StyleTokens();
+
+	//! \return Are tokens resolved for the current rendering quality?
+	bool isValid() const;
+	//! Mark tokens as obsolete, they will be resolved before next use.
+	void invalidate();
+	//! Init style option from the given \a widget and mark tokens valid.
+	void resolve( const QWidget * widget );
+	/*!
+		Refresh focus, hover and activation flags of the option's state
+		from the given \a widget. These change without change events, so
+		widgets call it on every use of the tokens.
+	*/
+	void updateState( const QWidget * widget );
+
+	//! \return Does the given \a event make resolved tokens obsolete?
+	static bool isInvalidatedBy( const QEvent * event );
+
+	//! Style option of the widget. Rect is as it was on resolving.
+	QStyleOption option;
+
+private:
+	bool valid;
+	RenderingQuality::Level level;
+}; // class StyleTokens
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__STYLETOKENS_HPP__INCLUDED
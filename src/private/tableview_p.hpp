@@ -9,12 +9,14 @@
 
 // QtMWidgets include.
 #include "scrollarea_p.hpp"
+#include "idlescheduler.hpp"
 #include "../tableview.hpp"
 
 // Qt include.
 #include <QLabel>
 #include <QList>
 #include <QVBoxLayout>
+#include <QScopedPointer>
 
 
 namespace QtMWidgets {
@@ -22,6 +24,7 @@ namespace QtMWidgets {
 class MinimumSizeLabel;
 class TextLabel;
 class TableViewCellLayout;
+class TableViewSectionLayout;
 
 
 //
@@ -59,8 +62,6 @@ public:
 	bool highlightOnClick;
 }; // class TableViewCellPrivate
 
-class RowsSeparator;
-
 //
 // TableViewSectionPrivate
 //
@@ -73,6 +74,10 @@ public:
 		,	footer( 0 )
 		,	layout( 0 )
 		,	highlightCellOnClick( false )
+		,	populateCount( 0 )
+		,	populateIndex( 0 )
+		,	estimatedCellHeight( 0 )
+		,	sliceDuration( 4 )
 	{
 	}
 
@@ -81,14 +86,31 @@ public:
 	}
 
 	void init();
+	//! Create cells for one slice. \return Is population finished?
+	bool populateSlice( const QDeadlineTimer & sliceEnd );
+	//! Update height of the placeholder of not yet created cells.
+	void updatePlaceholder();
+	//! Reset placeholder and cancel the job.
+	void stopPopulation();
 
 	TableViewSection * q;
 	TextLabel * header;
 	TextLabel * footer;
 	QList< TableViewCell* > cells;
-	QVBoxLayout * layout;
-	QList< RowsSeparator* > separators;
+	TableViewSectionLayout * layout;
 	bool highlightCellOnClick;
+	//! Factory used by populate().
+	TableViewSection::CellFactory factory;
+	//! Index after the last cell to be created by populate().
+	int populateCount;
+	//! Index of the next cell to be created by populate().
+	int populateIndex;
+	//! Job of the population in the IdleScheduler.
+	QScopedPointer< IdleJob > populateJob;
+	//! Estimated height of the not yet created cell.
+	int estimatedCellHeight;
+	//! Max duration of one population slice, in milliseconds.
+	int sliceDuration;
 }; // class TableViewSectionPrivate
 
 
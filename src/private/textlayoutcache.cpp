@@ -0,0 +1,208 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "textlayoutcache.hpp"
+
+// Qt include.
+#include <QTextDocument>
+#include <QHash>
+
+
+namespace QtMWidgets {
+
+//
+// TextLayoutKey
+//
+
+TextLayoutKey::TextLayoutKey( const QString & t, Qt::TextFormat f,
+	const QFont & fnt, const QTextOption & option, qreal w )
+	:	text( t )
+	,	format( f )
+	,	font( fnt )
+	,	alignment( option.alignment() )
+	,	flags( option.flags() )
+	,	wrapMode( option.wrapMode() )
+	,	width( w )
+{
+}
+
+bool operator == ( const TextLayoutKey & k1, const TextLayoutKey & k2 )
+{
+	return ( k1.width == k2.width && k1.format == k2.format &&
+		k1.alignment == k2.alignment && k1.flags == k2.flags &&
+		k1.wrapMode == k2.wrapMode && k1.text == k2.text &&
+		k1.font == k2.font );
+}
+
+size_t qHash( const TextLayoutKey & key, size_t seed )
+{
+	return qHashMulti( seed, key.text, key.font, key.width,
+		static_cast< int > ( key.format ),
+		static_cast< int > ( key.alignment ),
+		static_cast< int > ( key.flags ),
+		static_cast< int > ( key.wrapMode ) );
+}
+
+
+//
+// TextLayoutCache::Layout
+//
+
+struct TextLayoutCache::Layout {
+	Layout()
+		:	staticTextReady( false )
+		,	documentSizeReady( false )
+	{
+	}
+
+	QStaticText staticText;
+	bool staticTextReady;
+	QSizeF documentSize;
+	bool documentSizeReady;
+}; // struct TextLayoutCache::Layout
+
+
+//
+// TextLayoutCache
+//
+
+// Estimated bytes of the glyphs data per one character of the text.
+static const int c_bytesPerChar = 2 * sizeof( QChar ) + 16;
+
+static const int c_defaultMaxBytes = 2 * 1024 * 1024;
+
+TextLayoutCache::TextLayoutCache()
+	:	m_cache( QStringLiteral( "TextLayout" ), c_defaultMaxBytes )
+{
+}
+
+TextLayoutCache &
+TextLayoutCache::instance()
+{
+	static TextLayoutCache cache;
+
+	return cache;
+}
+
+TextLayoutCache::Layout *
+TextLayoutCache::layout( const TextLayoutKey & key )
+{
+	Layout * l = m_cache.object( key );
+
+	if( l )
+		return l;
+
+	const int cost = static_cast< int > ( sizeof( Layout ) + sizeof( TextLayoutKey ) ) +
+		key.text.size() * c_bytesPerChar;
+
+	l = new Layout;
+
+	if( !m_cache.insert( key, l, cost ) )
+	{
+		// Layout is bigger than the whole budget, it's not cached.
+		static Layout uncached;
+		uncached = Layout();
+
+		return &uncached;
+	}
+
+	return l;
+}
+
+QStaticText
+TextLayoutCache::staticText( const TextLayoutKey & key )
+{
+	Layout * l = layout( key );
+
+	if( !l->staticTextReady )
+	{
+		l->staticText.setText( key.text );
+		l->staticText.setTextFormat( key.format );
+
+		QTextOption opt;
+		opt.setAlignment( key.alignment );
+		opt.setFlags( key.flags );
+		opt.setWrapMode( key.wrapMode );
+		l->staticText.setTextOption( opt );
+
+		l->staticText.setTextWidth( key.width );
+		l->staticText.prepare( QTransform(), key.font );
+
+		l->staticTextReady = true;
+	}
+
+	return l->staticText;
+}
+
+QSizeF
+TextLayoutCache::documentSize( const TextLayoutKey & key )
+{
+	Layout * l = layout( key );
+
+	if( !l->documentSizeReady )
+	{
+		QTextOption opt;
+		opt.setAlignment( key.alignment );
+		opt.setFlags( key.flags );
+		opt.setWrapMode( key.wrapMode );
+
+		QTextDocument doc;
+		doc.setHtml( key.text );
+		doc.setDefaultTextOption( opt );
+		doc.setTextWidth( key.width );
+
+		l->documentSize = doc.size();
+		l->documentSizeReady = true;
+	}
+
+	return l->documentSize;
+}
+
+int
+TextLayoutCache::maxBytes() const
+{
+	return static_cast< int > ( m_cache.maxBytes() );
+}
+
+void
+TextLayoutCache::setMaxBytes( int bytes )
+{
+	m_cache.setMaxBytes( bytes );
+}
+
+int
+TextLayoutCache::usedBytes() const
+{
+	return static_cast< int > ( m_cache.usedBytes() );
+}
+
+int
+TextLayoutCache::count() const
+{
+	return m_cache.count();
+}
+
+qint64
+TextLayoutCache::hits() const
+{
+	return m_cache.hits();
+}
+
+qint64
+TextLayoutCache::misses() const
+{
+	return m_cache.misses();
+}
+
+void
+TextLayoutCache::clear()
+{
+	m_cache.clear();
+	m_cache.resetStatistics();
+}
+
+} /* namespace QtMWidgets */
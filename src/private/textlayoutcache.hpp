@@ -0,0 +1,108 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__TEXTLAYOUTCACHE_HPP__INCLUDED
+#define QTMWIDGETS__TEXTLAYOUTCACHE_HPP__INCLUDED
+
+// QtMWidgets include.
+#include "lrucache.hpp"
+
+// Qt include.
+#include <QString>
+#include <QFont>
+#include <QTextOption>
+#include <QStaticText>
+#include <QSizeF>
+
+
+namespace QtMWidgets {
+
+//
+// TextLayoutKey
+//
+
+//! Key of the text layout in the cache.
+class TextLayoutKey {
+public:
+	TextLayoutKey( const QString & text, Qt::TextFormat format,
+		const QFont & font, const QTextOption & option, qreal width );
+
+	QString text;
+	Qt::TextFormat format;
+	QFont font;
+	Qt::Alignment alignment;
+	QTextOption::Flags flags;
+	QTextOption::WrapMode wrapMode;
+	qreal width;
+}; // class TextLayoutKey
+
+bool operator == ( const TextLayoutKey & k1, const TextLayoutKey & k2 );
+
+size_t qHash( const TextLayoutKey & key, size_t seed = 0 );
+
+
+//
+// TextLayoutCache
+//
+
+/*!
+	Process-wide LRU of the text layouts used by TextLabel.
+
+	Labels with the same text, format, font, options and width
+	share one QStaticText and one height computation. Size of the
+	cache is limited by the own byte budget and by the global budget
+	of the CacheRegistry, where it's registered as "TextLayout".
+	The cost of the layout is estimated from the length of the text.
+
+	Should be used from the GUI thread only.
+*/
+class TextLayoutCache {
+public:
+	//! \return Instance of the cache.
+	static TextLayoutCache & instance();
+
+	/*!
+		\return Prepared static text. The returned QStaticText is
+		implicitly shared with the cached one.
+	*/
+	QStaticText staticText( const TextLayoutKey & key );
+
+	//! \return Size of the laid out document, used for height for width.
+	QSizeF documentSize( const TextLayoutKey & key );
+
+	//! \return Byte budget.
+	int maxBytes() const;
+	//! Set byte budget.
+	void setMaxBytes( int bytes );
+
+	//! \return Estimated bytes used by cached layouts.
+	int usedBytes() const;
+	//! \return Count of cached layouts.
+	int count() const;
+
+	//! \return Count of cache hits.
+	qint64 hits() const;
+	//! \return Count of cache misses.
+	qint64 misses() const;
+
+	//! Remove all layouts.
+	void clear();
+
+private:
+	TextLayoutCache();
+
+	struct Layout;
+
+	Layout * layout( const TextLayoutKey & key );
+
+	Q_DISABLE_COPY( TextLayoutCache )
+
+	LruCache< TextLayoutKey, Layout > m_cache;
+}; // class TextLayoutCache
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__TEXTLAYOUTCACHE_HPP__INCLUDED
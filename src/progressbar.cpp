@@ -6,10 +6,13 @@
 
 // QtMWidgets include.
 #include "progressbar.hpp"
+#include "private/styletokens.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QPainter>
 #include <QVariantAnimation>
+#include <QElapsedTimer>
 #ifndef QT_NO_ACCESSIBILITY
 #include <QAccessible>
 #endif
@@ -17,6 +20,49 @@
 
 namespace QtMWidgets {
 
+//
+// ProgressBarStyleTokens
+//
+
+class ProgressBarStyleTokens
+	:	public StyleTokens
+{
+public:
+	//! Resolve pens and brushes.
+	void resolve( const QWidget * widget, const QColor & highlight,
+		const QColor & groove );
+
+	//! Pen of the progress.
+	QPen highlightPen;
+	//! Brush of the progress.
+	QBrush highlightBrush;
+	//! Pen of the groove.
+	QPen groovePen;
+	//! Brush of the groove.
+	QBrush grooveBrush;
+	//! Pen of the busy animation.
+	QPen animationPen;
+	//! Brush of the busy animation.
+	QBrush animationBrush;
+}; // class ProgressBarStyleTokens
+
+void
+ProgressBarStyleTokens::resolve( const QWidget * widget,
+	const QColor & highlight, const QColor & groove )
+{
+	StyleTokens::resolve( widget );
+
+	const QColor animation = option.palette.color( QPalette::Base );
+
+	highlightPen = QPen( highlight );
+	highlightBrush = QBrush( highlight );
+	groovePen = QPen( groove );
+	grooveBrush = QBrush( groove );
+	animationPen = QPen( animation );
+	animationBrush = QBrush( animation );
+}
+
+
 //
 // ProgressBarPrivate
 //
@@ -43,6 +89,8 @@ public:
 	bool repaintRequired() const;
 	//! \return Groove rect.
 	QRect grooveRect() const;
+	//! \return Resolved style tokens.
+	const ProgressBarStyleTokens & styleTokens();
 
 	//! Parent;
 	ProgressBar * q;
@@ -64,12 +112,14 @@ public:
 	QColor highlightColor;
 	//! Groove color.
 	QColor grooveColor;
-	//! Color used for painting animation.
-	QColor animationColor;
+	//! Style tokens.
+	ProgressBarStyleTokens tokens;
 	//! Busy animation.
 	QVariantAnimation * animation;
 	//! Need paint animation?
 	bool animate;
+	//! Time since last frame of the busy animation.
+	QElapsedTimer frameTimer;
 }; // class ProgressBarPrivate
 
 void
@@ -77,7 +127,6 @@ ProgressBarPrivate::init()
 {
 	highlightColor = q->palette().color( QPalette::Highlight );
 	grooveColor = q->palette().color( QPalette::Dark );
-	animationColor = q->palette().color( QPalette::Base );
 
 	QSizePolicy sp( QSizePolicy::Expanding, QSizePolicy::Fixed );
 	if( orientation == Qt::Vertical )
@@ -116,6 +165,17 @@ ProgressBarPrivate::grooveRect() const
 	return q->rect();
 }
 
+const ProgressBarStyleTokens &
+ProgressBarPrivate::styleTokens()
+{
+	if( !tokens.isValid() )
+		tokens.resolve( q, highlightColor, grooveColor );
+
+	tokens.updateState( q );
+
+	return tokens;
+}
+
 
 //
 // ProgressBar
@@ -206,6 +266,7 @@ ProgressBar::setHighlightColor( const QColor & c )
 	if( d->highlightColor != c )
 	{
 		d->highlightColor = c;
+		d->tokens.invalidate();
 
 		update();
 	}
@@ -223,6 +284,7 @@ ProgressBar::setGrooveColor( const QColor & c )
 	if( d->grooveColor != c )
 	{
 		d->grooveColor = c;
+		d->tokens.invalidate();
 
 		update();
 	}
@@ -346,6 +408,8 @@ ProgressBar::setOrientation( Qt::Orientation orientation )
 void
 ProgressBar::paintEvent( QPaintEvent * )
 {
+	const ProgressBarStyleTokens & t = d->styleTokens();
+
 	QPainter p( this );
 
 	const QRect r = d->grooveRect();
@@ -377,13 +441,13 @@ ProgressBar::paintEvent( QPaintEvent * )
 			( d->orientation == Qt::Vertical && d->invertedAppearance ?
 				  -height : 0 ) );
 
-		p.setPen( d->grooveColor );
-		p.setBrush( d->grooveColor );
+		p.setPen( t.groovePen );
+		p.setBrush( t.grooveBrush );
 
 		p.drawRect( baseRect );
 
-		p.setPen( d->highlightColor );
-		p.setBrush( d->highlightColor );
+		p.setPen( t.highlightPen );
+		p.setBrush( t.highlightBrush );
 
 		p.drawRect( highlightedRect );
 	}
@@ -391,8 +455,8 @@ ProgressBar::paintEvent( QPaintEvent * )
 	{
 		const double value = d->animation->currentValue().toDouble();
 
-		p.setPen( d->highlightColor );
-		p.setBrush( d->highlightColor );
+		p.setPen( t.highlightPen );
+		p.setBrush( t.highlightBrush );
 
 		p.drawRect( r );
 
@@ -412,8 +476,8 @@ ProgressBar::paintEvent( QPaintEvent * )
 				r.y() + r.height() * value / 1.5 + r.height() / 3 ),
 			d->grooveHeight, d->grooveHeight );
 
-		p.setPen( d->animationColor );
-		p.setBrush( d->animationColor );
+		p.setPen( t.animationPen );
+		p.setBrush( t.animationBrush );
 
 		p.drawRect( a1 );
 		p.drawRect( a2 );
@@ -425,7 +489,17 @@ ProgressBar::_q_animation( const QVariant & value )
 {
 	Q_UNUSED( value )
 
-	update();
+	if( RenderingQuality::isFrameDue( d->frameTimer ) )
+		update();
+}
+
+void
+ProgressBar::changeEvent( QEvent * e )
+{
+	if( StyleTokens::isInvalidatedBy( e ) )
+		d->tokens.invalidate();
+
+	QWidget::changeEvent( e );
 }
 
 } /* namespace QtMWidgets */
@@ -185,6 +185,7 @@ public slots:
 
 protected:
 	void paintEvent( QPaintEvent * ) override;
+	void changeEvent( QEvent * e ) override;
 
 private slots:
 	void _q_animation( const QVariant & value );
@@ -0,0 +1,126 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// QtMWidgets include.
+#include "renderingquality.hpp"
+
+// Qt include.
+#include <QApplication>
+#include <QWidget>
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QByteArray>
+
+
+namespace QtMWidgets {
+
+static RenderingQuality::Level
+levelFromEnvironment()
+{
+	const QByteArray value =
+		qgetenv( "QTMWIDGETS_RENDERING_QUALITY" ).trimmed().toLower();
+
+	if( value == "reduced" )
+		return RenderingQuality::Reduced;
+	else if( value == "minimal" )
+		return RenderingQuality::Minimal;
+	else
+		return RenderingQuality::Full;
+}
+
+static RenderingQuality::Level s_level = levelFromEnvironment();
+
+static QPointer< RenderingQuality > s_instance;
+
+
+//
+// RenderingQuality
+//
+
+RenderingQuality::RenderingQuality( QObject * parent )
+	:	QObject( parent )
+{
+}
+
+RenderingQuality *
+RenderingQuality::instance()
+{
+	if( !s_instance )
+		s_instance = new RenderingQuality( QCoreApplication::instance() );
+
+	return s_instance.data();
+}
+
+RenderingQuality::Level
+RenderingQuality::level()
+{
+	return s_level;
+}
+
+void
+RenderingQuality::setLevel( Level l )
+{
+	if( s_level == l )
+		return;
+
+	s_level = l;
+
+	// Style tokens check the level on use, so repaint is enough.
+	if( qobject_cast< QApplication* > ( QCoreApplication::instance() ) )
+	{
+		foreach( QWidget * w, QApplication::allWidgets() )
+			w->update();
+	}
+
+	emit instance()->levelChanged( l );
+}
+
+bool
+RenderingQuality::antialiasing()
+{
+	return ( s_level == Full );
+}
+
+bool
+RenderingQuality::gradients()
+{
+	return ( s_level == Full );
+}
+
+bool
+RenderingQuality::decorations()
+{
+	return ( s_level != Minimal );
+}
+
+int
+RenderingQuality::frameInterval()
+{
+	switch( s_level )
+	{
+		case Reduced :
+			return 33;
+
+		case Minimal :
+			return 100;
+
+		default :
+			return 0;
+	}
+}
+
+bool
+RenderingQuality::isFrameDue( QElapsedTimer & timer )
+{
+	if( timer.isValid() && timer.elapsed() < frameInterval() )
+		return false;
+
+	timer.start();
+
+	return true;
+}
+
+} /* namespace QtMWidgets */
@@ -0,0 +1,88 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef QTMWIDGETS__RENDERINGQUALITY_HPP__INCLUDED
+#define QTMWIDGETS__RENDERINGQUALITY_HPP__INCLUDED
+
+// Qt include.
+#include <QObject>
+
+QT_BEGIN_NAMESPACE
+class QElapsedTimer;
+QT_END_NAMESPACE
+
+
+namespace QtMWidgets {
+
+//
+// RenderingQuality
+//
+
+/*!
+	RenderingQuality is a global setting of how expensive painting
+	of the widgets may be. On devices with software rasterization
+	antialiasing and gradient fills dominate frame time, so lower
+	levels trade look for speed.
+
+	Initial level may be set with QTMWIDGETS_RENDERING_QUALITY
+	environment variable ("full", "reduced" or "minimal"). Level
+	can be changed at runtime, for example when the device goes
+	on battery, all widgets are repainted then.
+*/
+class RenderingQuality
+	:	public QObject
+{
+	Q_OBJECT
+
+public:
+	//! Level of the rendering quality.
+	enum Level {
+		//! Antialiasing, gradients, effects and smooth animations.
+		Full = 0,
+		//! Flat fills, not antialiased primitives, ~30 FPS animations.
+		Reduced = 1,
+		//! As Reduced, without decorative effects, ~10 FPS animations.
+		Minimal = 2
+	}; // enum Level
+
+	Q_ENUM( Level )
+
+signals:
+	//! Emitted when rendering quality level changed.
+	void levelChanged( QtMWidgets::RenderingQuality::Level level );
+
+public:
+	//! \return Instance, use it to connect to levelChanged().
+	static RenderingQuality * instance();
+
+	//! \return Current level. Default is Full.
+	static Level level();
+	//! Set level and repaint all widgets.
+	static void setLevel( Level l );
+
+	//! \return Should primitives be antialiased?
+	static bool antialiasing();
+	//! \return Should gradients be used? Flat fills are used otherwise.
+	static bool gradients();
+	//! \return Should decorative effects (glow, blur) be painted?
+	static bool decorations();
+	//! \return Minimum interval between animation frames in milliseconds.
+	static int frameInterval();
+	/*!
+		\return Is it time to paint next animation frame? Restarts
+		\a timer if so.
+	*/
+	static bool isFrameDue( QElapsedTimer & timer );
+
+private:
+	explicit RenderingQuality( QObject * parent );
+
+	Q_DISABLE_COPY( RenderingQuality )
+}; // class RenderingQuality
+
+} /* namespace QtMWidgets */
+
+#endif // QTMWIDGETS__RENDERINGQUALITY_HPP__INCLUDED
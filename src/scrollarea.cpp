@@ -107,10 +107,7 @@ ScrollArea::setWidget( QWidget * widget )
 	if( widget == d->widget || !widget )
 		return;
 
-	d->horIndicator->setParent( 0 );
-	d->vertIndicator->setParent( 0 );
-	d->horBlur->setParent( 0 );
-	d->vertBlur->setParent( 0 );
+	d->setHelpersParent( 0 );
 	delete d->widget;
 	d->widget = 0;
 	if( widget->parentWidget() != d->viewport )
@@ -118,12 +115,7 @@ ScrollArea::setWidget( QWidget * widget )
 	if( !widget->testAttribute( Qt::WA_Resized ) )
 		widget->resize( widget->sizeHint() );
 	d->widget = widget;
-	d->horIndicator->setParent( d->widget );
-	d->horIndicator->raise();
-	d->vertIndicator->setParent( d->widget );
-	d->vertIndicator->raise();
-	d->horBlur->setParent( d->widget );
-	d->vertBlur->setParent( d->widget );
+	d->setHelpersParent( d->widget );
 	d->widget->setAutoFillBackground( true );
 	widget->installEventFilter( this );
 	d->updateScrolledSize();
@@ -136,10 +128,7 @@ ScrollArea::takeWidget()
 	ScrollAreaPrivate * d = d_func();
 	QWidget * w = d->widget;
 	w->removeEventFilter( this );
-	d->horIndicator->setParent( d->viewport );
-	d->vertIndicator->setParent( d->viewport );
-	d->horBlur->setParent( d->viewport );
-	d->vertBlur->setParent( d->viewport );
+	d->setHelpersParent( d->viewport );
 	d->widget = 0;
 	if( w )
 		w->setParent( 0 );
@@ -8,6 +8,8 @@
 #include "slider.hpp"
 #include "color.hpp"
 #include "private/drawing.hpp"
+#include "private/styletokens.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QPainter>
@@ -18,6 +20,35 @@
 
 namespace QtMWidgets {
 
+//
+// SliderStyleTokens
+//
+
+class SliderStyleTokens
+	:	public StyleTokens
+{
+public:
+	//! Resolve colors and brushes.
+	void resolve( const QWidget * widget );
+
+	QColor grooveColor;
+	QColor borderColor;
+	QColor lightColor;
+	QBrush handleBrush;
+}; // class SliderStyleTokens
+
+void
+SliderStyleTokens::resolve( const QWidget * widget )
+{
+	StyleTokens::resolve( widget );
+
+	grooveColor = option.palette.color( QPalette::Dark );
+	borderColor = option.palette.color( QPalette::Shadow );
+	lightColor = option.palette.color( QPalette::Base );
+	handleBrush = sliderHandleBrush( lightColor );
+}
+
+
 //
 // SliderPrivate
 //
@@ -39,6 +70,8 @@ public:
 	inline int pick( const QPoint & pt ) const;
 	QRect grooveRect() const;
 	QRect grooveHighlightedRect( const QRect & sh, const QRect & gr ) const;
+	//! \return Resolved style tokens.
+	const SliderStyleTokens & styleTokens();
 
 	Slider * q;
 	int radius;
@@ -46,6 +79,7 @@ public:
 	QStyle::SubControl pressedControl;
 	int clickOffset;
 	QColor highlightColor;
+	SliderStyleTokens tokens;
 }; // class SliderPrivate;
 
 void
@@ -63,6 +97,17 @@ SliderPrivate::init()
 	highlightColor = q->palette().color( QPalette::Highlight );
 }
 
+const SliderStyleTokens &
+SliderPrivate::styleTokens()
+{
+	if( !tokens.isValid() )
+		tokens.resolve( q );
+
+	tokens.updateState( q );
+
+	return tokens;
+}
+
 QRect
 SliderPrivate::handleRect() const
 {
@@ -277,12 +322,12 @@ Slider::paintEvent( QPaintEvent * )
 	const QRect gr = d->grooveRect();
 	const QRect grh = d->grooveHighlightedRect( sh, gr );
 
-	QPainter p( this );
+	const SliderStyleTokens & t = d->styleTokens();
 
-	const QColor grooveColor = palette().color( QPalette::Dark );
+	QPainter p( this );
 
-	p.setPen( grooveColor );
-	p.setBrush( grooveColor );
+	p.setPen( t.grooveColor );
+	p.setBrush( t.grooveColor );
 
 	p.drawRect( gr );
 
@@ -291,10 +336,9 @@ Slider::paintEvent( QPaintEvent * )
 
 	p.drawRect( grh );
 
-	p.setRenderHint( QPainter::Antialiasing );
+	p.setRenderHint( QPainter::Antialiasing, RenderingQuality::antialiasing() );
 	drawSliderHandle( &p, sh, d->radius, d->radius,
-		palette().color( QPalette::Shadow ),
-		palette().color( QPalette::Base ) );
+		t.borderColor, t.lightColor, t.handleBrush );
 }
 
 void
@@ -383,4 +427,13 @@ Slider::mouseMoveEvent( QMouseEvent * e )
 	setSliderPosition( newPosition );
 }
 
+void
+Slider::changeEvent( QEvent * e )
+{
+	if( StyleTokens::isInvalidatedBy( e ) )
+		d->tokens.invalidate();
+
+	QAbstractSlider::changeEvent( e );
+}
+
 } /* namespace QtMWidgets */
@@ -84,6 +84,7 @@ protected:
 	void mousePressEvent( QMouseEvent * e ) override;
 	void mouseReleaseEvent( QMouseEvent * e ) override;
 	void mouseMoveEvent( QMouseEvent * e ) override;
+	void changeEvent( QEvent * e ) override;
 
 private:
 	Q_DISABLE_COPY( Slider )
@@ -8,6 +8,7 @@
 #include "stepper.hpp"
 #include "fingergeometry.hpp"
 #include "color.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QPainter>
@@ -395,7 +396,7 @@ void
 Stepper::paintEvent( QPaintEvent * )
 {
 	QPainter p( this );
-	p.setRenderHint( QPainter::Antialiasing );
+	p.setRenderHint( QPainter::Antialiasing, RenderingQuality::antialiasing() );
 	p.translate( 1.0, 1.0 );
 
 	const qreal width = rect().width() - 2;
@@ -8,7 +8,9 @@
 #include "switch.hpp"
 #include "color.hpp"
 #include "private/drawing.hpp"
+#include "private/styletokens.hpp"
 #include "fingergeometry.hpp"
+#include "renderingquality.hpp"
 
 // Qt include.
 #include <QStyleOption>
@@ -20,6 +22,89 @@
 
 namespace QtMWidgets {
 
+//
+// SwitchStyleTokens
+//
+
+class SwitchStyleTokens
+	:	public StyleTokens
+{
+public:
+	SwitchStyleTokens()
+		:	pathsRadius( -1 )
+	{
+	}
+
+	//! Resolve colors and brushes.
+	void resolve( const QWidget * widget, const QColor & onColor );
+	//! Rebuild frame and glow paths if size or radius changed.
+	void resolvePaths( int radius );
+
+	QColor borderColor;
+	QColor lightColor;
+	QBrush uncheckedBrush;
+	QBrush notAcceptedCheckBrush;
+	QBrush glowBrush;
+	QBrush handleBrush;
+	QPainterPath frame;
+	QPainterPath glow;
+	QSize pathsSize;
+	int pathsRadius;
+}; // class SwitchStyleTokens
+
+void
+SwitchStyleTokens::resolve( const QWidget * widget, const QColor & onColor )
+{
+	StyleTokens::resolve( widget );
+
+	borderColor = option.palette.color( QPalette::Shadow );
+	lightColor = option.palette.color( QPalette::Base );
+
+	if( RenderingQuality::gradients() )
+	{
+		QLinearGradient g( QPointF( 0.0, 0.0 ), QPointF( 0.0, 1.0 ) );
+		g.setCoordinateMode( QGradient::ObjectBoundingMode );
+		g.setColorAt( 0.0, darkerColor( lightColor, 75 ) );
+		g.setColorAt( 0.1, darkerColor( lightColor, 25 ) );
+		g.setColorAt( 1.0, darkerColor( lightColor, 10 ) );
+
+		uncheckedBrush = QBrush( g );
+	}
+	else
+		uncheckedBrush = QBrush( darkerColor( lightColor, 10 ) );
+	notAcceptedCheckBrush = QBrush( darkerColor( onColor, 50 ) );
+
+	QColor lightAlphaColor = lightColor;
+	lightAlphaColor.setAlpha( 50 );
+
+	glowBrush = QBrush( lightAlphaColor );
+	handleBrush = sliderHandleBrush( lightColor );
+}
+
+void
+SwitchStyleTokens::resolvePaths( int radius )
+{
+	const QSize s = option.rect.size();
+
+	if( s == pathsSize && radius == pathsRadius )
+		return;
+
+	pathsSize = s;
+	pathsRadius = radius;
+
+	frame = QPainterPath();
+	frame.addRoundedRect( 0, 0, s.width() - 2, radius * 2,
+		radius, radius );
+
+	QPainterPath glowRect;
+	glowRect.addRoundedRect( radius / 4, radius,
+		s.width() - radius / 2, radius * 2,
+		radius / 2, radius / 2 );
+
+	glow = frame.intersected( glowRect );
+}
+
+
 //
 // SwitchPrivate
 //
@@ -45,6 +130,8 @@ public:
 	void drawText( QPainter * p, const QStyleOption & opt,
 		const QColor & on, const QColor & off );
 	void initOffset( const QRect & r );
+	//! \return Resolved style tokens.
+	const SwitchStyleTokens & styleTokens();
 
 	Switch * q;
 	Switch::State state;
@@ -57,6 +144,7 @@ public:
 	int mouseMoveDelta;
 	bool leftMouseButtonPressed;
 	QPoint mousePos;
+	SwitchStyleTokens tokens;
 }; // class SwitchPrivate
 
 bool
@@ -104,6 +192,19 @@ SwitchPrivate::init()
 	onColor = opt.palette.color( QPalette::Highlight );
 }
 
+const SwitchStyleTokens &
+SwitchPrivate::styleTokens()
+{
+	if( !tokens.isValid() )
+		tokens.resolve( q, onColor );
+
+	tokens.updateState( q );
+	tokens.option.rect = q->rect();
+	tokens.resolvePaths( radius );
+
+	return tokens;
+}
+
 void
 SwitchPrivate::emitSignals()
 {
@@ -251,6 +352,7 @@ Switch::setOnColor( const QColor & c )
 	if( d->onColor != c )
 	{
 		d->onColor = c;
+		d->tokens.invalidate();
 
 		switch( d->state )
 		{
@@ -295,33 +397,21 @@ Switch::sizeHint() const
 void
 Switch::paintEvent( QPaintEvent * )
 {
-	QStyleOption opt;
-	opt.initFrom( this );
-
-	QColor borderColor = opt.palette.color( QPalette::Shadow );
-	QColor lightColor = opt.palette.color( QPalette::Base );
+	const SwitchStyleTokens & t = d->styleTokens();
 
 	QPainter p( this );
 	p.translate( 1.0, 1.0 );
-	p.setRenderHint( QPainter::Antialiasing );
+	p.setRenderHint( QPainter::Antialiasing, RenderingQuality::antialiasing() );
 
 	switch( d->state )
 	{
 		case NotAcceptedUncheck :
 		case AcceptedUncheck :
-		{
-			QLinearGradient g( QPointF( 0.0, 0.0 ), QPointF( 0.0, 1.0 ) );
-			g.setCoordinateMode( QGradient::ObjectBoundingMode );
-			g.setColorAt( 0.0, darkerColor( lightColor, 75 ) );
-			g.setColorAt( 0.1, darkerColor( lightColor, 25 ) );
-			g.setColorAt( 1.0, darkerColor( lightColor, 10 ) );
-
-			p.setBrush( g );
-		}
+			p.setBrush( t.uncheckedBrush );
 		break;
 
 		case NotAcceptedCheck :
-			p.setBrush( darkerColor( d->onColor, 50 ) );
+			p.setBrush( t.notAcceptedCheckBrush );
 		break;
 
 		case AcceptedCheck :
@@ -329,32 +419,24 @@ Switch::paintEvent( QPaintEvent * )
 		break;
 	}
 
-	p.setPen( borderColor );
-
-	QPainterPath rect;
-	rect.addRoundedRect( 0, 0, opt.rect.width() - 2, d->radius * 2,
-		d->radius, d->radius );
+	p.setPen( t.borderColor );
 
-	p.drawPath( rect );
+	p.drawPath( t.frame );
 
-	d->drawText( &p, opt, lightColor, borderColor );
+	d->drawText( &p, t.option, t.lightColor, t.borderColor );
 
-	QColor lightAlphaColor = lightColor;
-	lightAlphaColor.setAlpha( 50 );
-
-	p.setPen( Qt::NoPen );
-	p.setBrush( lightAlphaColor );
-
-	QPainterPath glow;
-	glow.addRoundedRect( d->radius / 4, d->radius,
-		opt.rect.width() - d->radius / 2, d->radius * 2,
-		d->radius / 2, d->radius / 2 );
+	if( RenderingQuality::decorations() )
+	{
+		p.setPen( Qt::NoPen );
+		p.setBrush( t.glowBrush );
 
-	p.drawPath( rect.intersected( glow ) );
+		p.drawPath( t.glow );
+	}
 
 	drawSliderHandle( &p, QRect( d->offset, 0,
 		d->radius * 2, d->radius * 2 ),
-			d->radius, d->radius, borderColor, lightColor );
+			d->radius, d->radius, t.borderColor, t.lightColor,
+			t.handleBrush );
 }
 
 void
@@ -464,4 +546,13 @@ Switch::mouseMoveEvent( QMouseEvent * event )
 	event->accept();
 }
 
+void
+Switch::changeEvent( QEvent * event )
+{
+	if( StyleTokens::isInvalidatedBy( event ) )
+		d->tokens.invalidate();
+
+	QWidget::changeEvent( event );
+}
+
 } /* namespace QtMWidgets */
@@ -9,6 +9,7 @@
 #include "textlabel.hpp"
 #include "private/tableview_p.hpp"
 #include "fingergeometry.hpp"
+#include "private/idlescheduler.hpp"
 
 // Qt include.
 #include <QVBoxLayout>
@@ -553,6 +554,284 @@ TableViewCell::mouseReleaseEvent( QMouseEvent * e )
 }
 
 
+//
+// TableViewSectionLayout
+//
+
+/*
+	Layout of the section: header, cells with 1 pixel gaps for
+	separators, placeholder of not yet created cells and footer.
+	Separators are painted by the section.
+*/
+class TableViewSectionLayout
+	:	public QLayout
+{
+public:
+	TableViewSectionLayout( QWidget * parent,
+		const QList< TableViewCell* > & cells );
+	virtual ~TableViewSectionLayout();
+
+	void setHeader( TextLabel * label );
+	void setFooter( TextLabel * label );
+
+	//! \return Height of the placeholder.
+	int placeholderHeight() const;
+	//! Set height of the placeholder.
+	void setPlaceholderHeight( int h );
+
+	void addItem( QLayoutItem * item ) override;
+	int count() const override;
+	QLayoutItem * itemAt( int index ) const override;
+	void setGeometry( const QRect & rect ) override;
+	QLayoutItem * takeAt( int index ) override;
+	bool hasHeightForWidth() const override;
+	int heightForWidth( int w ) const override;
+	void invalidate() override;
+
+	QSize minimumSize() const override;
+	QSize sizeHint() const override;
+
+private:
+	//! \return Height of the \a w widget with the given \a width.
+	static int widgetHeight( QWidget * w, int width );
+
+private:
+	const QList< TableViewCell* > & cells;
+	TextLabel * header;
+	TextLabel * footer;
+	int placeholder;
+	mutable int cachedWidth;
+	mutable int cachedHeight;
+}; // class TableViewSectionLayout
+
+TableViewSectionLayout::TableViewSectionLayout( QWidget * parent,
+	const QList< TableViewCell* > & c )
+	:	QLayout( parent )
+	,	cells( c )
+	,	header( 0 )
+	,	footer( 0 )
+	,	placeholder( 0 )
+	,	cachedWidth( -1 )
+	,	cachedHeight( -1 )
+{
+}
+
+TableViewSectionLayout::~TableViewSectionLayout()
+{
+}
+
+void
+TableViewSectionLayout::setHeader( TextLabel * label )
+{
+	header = label;
+
+	invalidate();
+}
+
+void
+TableViewSectionLayout::setFooter( TextLabel * label )
+{
+	footer = label;
+
+	invalidate();
+}
+
+int
+TableViewSectionLayout::placeholderHeight() const
+{
+	return placeholder;
+}
+
+void
+TableViewSectionLayout::setPlaceholderHeight( int h )
+{
+	if( placeholder != h )
+	{
+		placeholder = h;
+
+		invalidate();
+	}
+}
+
+void
+TableViewSectionLayout::addItem( QLayoutItem * item )
+{
+	Q_UNUSED( item )
+}
+
+int
+TableViewSectionLayout::count() const
+{
+	return 0;
+}
+
+QLayoutItem *
+TableViewSectionLayout::itemAt( int index ) const
+{
+	Q_UNUSED( index )
+
+	return 0;
+}
+
+QLayoutItem *
+TableViewSectionLayout::takeAt( int index )
+{
+	Q_UNUSED( index )
+
+	return 0;
+}
+
+int
+TableViewSectionLayout::widgetHeight( QWidget * w, int width )
+{
+	if( !w || w->isHidden() )
+		return 0;
+
+	const int h = ( w->hasHeightForWidth() ? w->heightForWidth( width ) :
+		w->sizeHint().height() );
+
+	return qBound( w->minimumHeight(), h, w->maximumHeight() );
+}
+
+void
+TableViewSectionLayout::setGeometry( const QRect & rect )
+{
+	QLayout::setGeometry( rect );
+
+	const int x = rect.x();
+	const int width = rect.width();
+	int y = rect.y();
+
+	int h = widgetHeight( header, width );
+	header->setGeometry( x, y, width, h );
+	y += h;
+
+	bool first = true;
+
+	foreach( TableViewCell * cell, cells )
+	{
+		if( cell->isHidden() )
+			continue;
+
+		if( !first )
+			++y;
+
+		first = false;
+
+		h = widgetHeight( cell, width );
+		cell->setGeometry( x, y, width, h );
+		y += h;
+	}
+
+	y += placeholder;
+
+	footer->setGeometry( x, y, width, widgetHeight( footer, width ) );
+}
+
+bool
+TableViewSectionLayout::hasHeightForWidth() const
+{
+	return true;
+}
+
+int
+TableViewSectionLayout::heightForWidth( int w ) const
+{
+	if( w == cachedWidth )
+		return cachedHeight;
+
+	int height = widgetHeight( header, w ) + widgetHeight( footer, w ) +
+		placeholder;
+
+	bool first = true;
+
+	foreach( TableViewCell * cell, cells )
+	{
+		if( cell->isHidden() )
+			continue;
+
+		if( !first )
+			++height;
+
+		first = false;
+
+		height += widgetHeight( cell, w );
+	}
+
+	cachedWidth = w;
+	cachedHeight = height;
+
+	return height;
+}
+
+void
+TableViewSectionLayout::invalidate()
+{
+	cachedWidth = -1;
+	cachedHeight = -1;
+
+	QLayout::invalidate();
+}
+
+QSize
+TableViewSectionLayout::minimumSize() const
+{
+	int width = qMax( header->minimumSizeHint().width(),
+		footer->minimumSizeHint().width() );
+
+	foreach( TableViewCell * cell, cells )
+		if( !cell->isHidden() )
+			width = qMax( width, cell->minimumSizeHint().width() );
+
+	return QSize( width, heightForWidth( width ) );
+}
+
+QSize
+TableViewSectionLayout::sizeHint() const
+{
+	int width = qMax( header->sizeHint().width(),
+		footer->sizeHint().width() );
+
+	foreach( TableViewCell * cell, cells )
+		if( !cell->isHidden() )
+			width = qMax( width, cell->sizeHint().width() );
+
+	return QSize( width, heightForWidth( width ) );
+}
+
+
+//
+// TableViewSectionPopulateJob
+//
+
+class TableViewSectionPopulateJob
+	:	public IdleJob
+{
+public:
+	explicit TableViewSectionPopulateJob( TableViewSectionPrivate * dd )
+		:	IdleJob( "TableViewSection::populate" )
+		,	d( dd )
+	{
+	}
+
+protected:
+	bool run( const QDeadlineTimer & sliceEnd ) override
+	{
+		return d->populateSlice( sliceEnd );
+	}
+
+	void finished() override
+	{
+		d->stopPopulation();
+
+		emit d->q->populated();
+	}
+
+private:
+	TableViewSectionPrivate * d;
+}; // class TableViewSectionPopulateJob
+
+
 //
 // TableViewSectionPrivate
 //
@@ -564,8 +843,7 @@ TableViewSectionPrivate::init()
 	q->setBackgroundRole( QPalette::Base );
 	q->setAutoFillBackground( true );
 
-	layout = new QVBoxLayout( q );
-	layout->setSpacing( 0 );
+	layout = new TableViewSectionLayout( q, cells );
 	layout->setContentsMargins( 0, 0, 0, 0 );
 
 	QSizePolicy sp( QSizePolicy::Minimum, QSizePolicy::Fixed );
@@ -576,7 +854,7 @@ TableViewSectionPrivate::init()
 	header->setAutoFillBackground( true );
 	header->setMargin( 11 );
 	header->setSizePolicy( sp );
-	layout->addWidget( header );
+	layout->setHeader( header );
 
 	footer = new TextLabel( q );
 	QFont font = footer->font();
@@ -586,38 +864,68 @@ TableViewSectionPrivate::init()
 	footer->setAutoFillBackground( true );
 	footer->setMargin( 11 );
 	footer->setSizePolicy( sp );
-	layout->addWidget( footer );
+	layout->setFooter( footer );
 }
 
-
-//
-// RowsSeparator
-//
-
-class RowsSeparator
-	:	public QWidget
+bool
+TableViewSectionPrivate::populateSlice( const QDeadlineTimer & sliceEnd )
 {
-public:
-	RowsSeparator( QWidget * parent = 0 )
-		:	QWidget( parent )
+	const QDeadlineTimer sectionSliceEnd( sliceDuration );
+
+	while( populateIndex < populateCount )
 	{
-		setSizePolicy( QSizePolicy::Expanding, QSizePolicy::Fixed );
+		TableViewCell * cell = factory( populateIndex, q );
+
+		++populateIndex;
+
+		if( cell )
+			q->addCell( cell );
+
+		if( sliceEnd.hasExpired() || sectionSliceEnd.hasExpired() )
+			break;
 	}
 
-	QSize sizeHint() const override
+	if( populateIndex < populateCount )
 	{
-		return QSize( 1, 1 );
+		updatePlaceholder();
+
+		return false;
 	}
 
-protected:
-	void paintEvent( QPaintEvent * ) override
+	return true;
+}
+
+void
+TableViewSectionPrivate::updatePlaceholder()
+{
+	if( estimatedCellHeight == 0 && !cells.isEmpty() )
 	{
-		QPainter p( this );
+		int total = 0;
+
+		foreach( TableViewCell * cell, cells )
+			total += cell->sizeHint().height();
 
-		p.setPen( palette().color( QPalette::Midlight ) );
-		p.drawLine( 11, 0, width(), 0 );
+		// 1 pixel is for the separator between rows.
+		estimatedCellHeight = total / cells.size() + 1;
 	}
-}; // class RowsSeparator
+
+	layout->setPlaceholderHeight(
+		estimatedCellHeight * ( populateCount - populateIndex ) );
+}
+
+void
+TableViewSectionPrivate::stopPopulation()
+{
+	if( populateJob )
+		IdleScheduler::instance()->cancel( populateJob.data() );
+
+	layout->setPlaceholderHeight( 0 );
+
+	factory = TableViewSection::CellFactory();
+	estimatedCellHeight = 0;
+	populateCount = 0;
+	populateIndex = 0;
+}
 
 
 //
@@ -662,21 +970,10 @@ TableViewSection::insertCell( int index, TableViewCell * cell )
 	if( index > d->cells.size() )
 		index = d->cells.size();
 
-	int actualIndex = ( index == 0 ? 1 : index + d->cells.size() );
-
-	if( index != 0 )
-	{
-		RowsSeparator * s = new RowsSeparator( this );
-		d->layout->insertWidget( actualIndex, s );
-		d->separators.insert( index - 1, s );
-		s->show();
-		++actualIndex;
-	}
-
 	if( cell->parent() != this )
 		cell->setParent( this );
-	d->layout->insertWidget( actualIndex, cell );
 	d->cells.insert( index, cell );
+	d->layout->invalidate();
 	cell->setHighlightOnClick( d->highlightCellOnClick );
 	cell->show();
 }
@@ -697,19 +994,11 @@ TableViewSection::removeCell( int index )
 	{
 		TableViewCell * cell = d->cells.at( index );
 
-		if( index != 0 )
-		{
-			RowsSeparator * s = d->separators.at( index - 1 );
-			d->layout->removeWidget( s );
-			d->separators.removeAt( index - 1 );
-			delete s;
-		}
-
-		d->layout->removeWidget( cell );
 		cell->setParent( 0 );
 		cell->hide();
 
 		d->cells.removeAt( index );
+		d->layout->invalidate();
 
 		adjustSize();
 
@@ -752,6 +1041,111 @@ TableViewSection::setHighlightCellOnClick( bool on )
 	}
 }
 
+void
+TableViewSection::populate( int count, const CellFactory & factory )
+{
+	if( count <= 0 || !factory )
+		return;
+
+	if( isPopulating() )
+		d->stopPopulation();
+
+	d->factory = factory;
+	d->populateIndex = 0;
+	d->populateCount = count;
+
+	if( !d->populateJob )
+		d->populateJob.reset( new TableViewSectionPopulateJob( d.data() ) );
+
+	IdleScheduler * scheduler = IdleScheduler::instance();
+
+	scheduler->post( d->populateJob.data() );
+	scheduler->runSlice( d->populateJob.data() );
+}
+
+bool
+TableViewSection::isPopulating() const
+{
+	return ( d->populateIndex < d->populateCount );
+}
+
+int
+TableViewSection::pendingCellsCount() const
+{
+	return ( d->populateCount - d->populateIndex );
+}
+
+void
+TableViewSection::cancelPopulation()
+{
+	if( isPopulating() )
+		d->stopPopulation();
+}
+
+int
+TableViewSection::populationSliceDuration() const
+{
+	return d->sliceDuration;
+}
+
+void
+TableViewSection::setPopulationSliceDuration( int ms )
+{
+	if( ms <= 0 )
+	{
+		qWarning( "TableViewSection::setPopulationSliceDuration(): "
+			"duration should be greater than 0." );
+
+		return;
+	}
+
+	d->sliceDuration = ms;
+}
+
+MemoryUsage
+TableViewSection::memoryUsage() const
+{
+	MemoryUsage u;
+	u.add( MemoryUsage::Data, widgetBytes( sizeof( TableViewSection ) ) +
+		sizeof( TableViewSectionPrivate ) +
+		d->cells.size() * sizeof( TableViewCell* ) );
+
+	if( d->populateJob )
+		u.add( MemoryUsage::Data, sizeof( IdleJob ) );
+
+	return u;
+}
+
+void
+TableViewSection::paintEvent( QPaintEvent * e )
+{
+	QWidget::paintEvent( e );
+
+	QPainter p( this );
+	p.setPen( palette().color( QPalette::Midlight ) );
+
+	bool first = true;
+
+	foreach( TableViewCell * cell, d->cells )
+	{
+		if( cell->isHidden() )
+			continue;
+
+		if( !first )
+		{
+			// Separator is in the 1 pixel gap above the cell.
+			const int y = cell->geometry().top() - 1;
+
+			if( y > e->rect().bottom() )
+				break;
+			else if( y >= e->rect().top() )
+				p.drawLine( 11, y, width(), y );
+		}
+
+		first = false;
+	}
+}
+
 
 //
 // TableViewPrivate
@@ -899,4 +1293,17 @@ TableView::setHighlightCellOnClick( bool on )
 	}
 }
 
+MemoryUsage
+TableView::memoryUsage() const
+{
+	const TableViewPrivate * d = d_func();
+
+	MemoryUsage u = ScrollArea::memoryUsage();
+	u.add( MemoryUsage::Data, sizeof( TableView ) - sizeof( AbstractScrollArea ) +
+		sizeof( TableViewPrivate ) - sizeof( AbstractScrollAreaPrivate ) +
+		d->sections.size() * sizeof( TableViewSection* ) );
+
+	return u;
+}
+
 } /* namespace QtMWidgets */
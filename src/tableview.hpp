@@ -11,6 +11,9 @@
 #include <QWidget>
 #include <QScopedPointer>
 
+// C++ include.
+#include <functional>
+
 // QtMWidgets include.
 #include "scrollarea.hpp"
 
@@ -121,7 +124,15 @@ class TableViewSection
 	Q_PROPERTY( bool highlightCellOnClick READ highlightCellOnClick
 		WRITE setHighlightCellOnClick )
 
+signals:
+	//! Emitted when all cells requested by populate() are created.
+	void populated();
+
 public:
+	//! Factory of the cell with the given \a index for the \a section.
+	typedef std::function< TableViewCell* ( int index,
+		TableViewSection * section ) > CellFactory;
+
 	TableViewSection( QWidget * parent = 0 );
 	virtual ~TableViewSection();
 
@@ -173,6 +184,41 @@ public:
 	//! Enable/disable highlighting of the cell on click.
 	void setHighlightCellOnClick( bool on );
 
+	/*!
+		Add \a count cells created by the \a factory to the bottom
+		without blocking of the event loop.
+
+		Cells are created by the idle scheduler in slices of at most
+		populationSliceDuration() milliseconds. The first slice is
+		created immediately, so the top of the section is ready when
+		this method returns. The rest of the section is reserved with
+		the placeholder of the estimated height. populated() will be
+		emitted when all cells are created.
+
+		If the factory returns 0 the cell is skipped.
+	*/
+	void populate( int count, const CellFactory & factory );
+	//! \return Is population in progress?
+	bool isPopulating() const;
+	//! \return Count of cells not yet created by populate().
+	int pendingCellsCount() const;
+	//! Stop population, not yet created cells won't be created.
+	void cancelPopulation();
+
+	//! \return Max duration of one population slice, in milliseconds.
+	int populationSliceDuration() const;
+	//! Set max duration of one population slice, in milliseconds.
+	void setPopulationSliceDuration( int ms );
+
+	/*!
+		\return Approximate memory owned by the section itself,
+		without cells.
+	*/
+	MemoryUsage memoryUsage() const;
+
+protected:
+	void paintEvent( QPaintEvent * e ) override;
+
 private:
 	friend class TableViewSectionPrivate;
 
@@ -257,6 +303,8 @@ public:
 	//! Enable/disable highlighting of the cell on click.
 	void setHighlightCellOnClick( bool on );
 
+	MemoryUsage memoryUsage() const override;
+
 private:
 	Q_DISABLE_COPY( TableView )
 
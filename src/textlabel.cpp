@@ -6,13 +6,13 @@
 
 // QtMWidgets include.
 #include "textlabel.hpp"
+#include "private/textlayoutcache.hpp"
 
 // Qt include.
 #include <QStaticText>
 #include <QPainter>
 #include <QResizeEvent>
 #include <QFontMetrics>
-#include <QTextDocument>
 
 
 namespace QtMWidgets {
@@ -25,14 +25,29 @@ class TextLabelPrivate {
 public:
 	TextLabelPrivate( TextLabel * parent )
 		:	q( parent )
+		,	format( Qt::AutoText )
+		,	textWidth( -1.0 )
+		,	layoutValid( false )
 		,	margin( 0 )
 	{
 	}
 
 	void init();
+	//! \return Key of the layout with the given \a width.
+	TextLayoutKey key( qreal width ) const;
+	//! \return Shared layout of the text.
+	const QStaticText & layout();
+	//! Set width of the text.
+	void setTextWidth( qreal w );
 
 	TextLabel * q;
+	QString text;
+	Qt::TextFormat format;
+	QTextOption option;
+	qreal textWidth;
+	//! Layout from the TextLayoutCache.
 	QStaticText staticText;
+	bool layoutValid;
 	int margin;
 	QColor color;
 }; // class TextLabelPrivate
@@ -40,15 +55,11 @@ public:
 void
 TextLabelPrivate::init()
 {
-	staticText.setTextFormat( Qt::AutoText );
+	option.setAlignment( Qt::AlignLeft );
+	option.setFlags( QTextOption::IncludeTrailingSpaces );
+	option.setWrapMode( QTextOption::WordWrap );
 
-	QTextOption opt;
-	opt.setAlignment( Qt::AlignLeft );
-	opt.setFlags( QTextOption::IncludeTrailingSpaces );
-	opt.setWrapMode( QTextOption::WordWrap );
-	staticText.setTextOption( opt );
-
-	staticText.setTextWidth( q->fontMetrics().averageCharWidth() * 10 );
+	textWidth = q->fontMetrics().averageCharWidth() * 10;
 
 	QSizePolicy sp( QSizePolicy::Preferred, QSizePolicy::Preferred );
 	sp.setHeightForWidth( true );
@@ -57,6 +68,34 @@ TextLabelPrivate::init()
 	color = q->palette().color( QPalette::WindowText );
 }
 
+TextLayoutKey
+TextLabelPrivate::key( qreal width ) const
+{
+	return TextLayoutKey( text, format, q->font(), option, width );
+}
+
+const QStaticText &
+TextLabelPrivate::layout()
+{
+	if( !layoutValid )
+	{
+		staticText = TextLayoutCache::instance().staticText( key( textWidth ) );
+		layoutValid = true;
+	}
+
+	return staticText;
+}
+
+void
+TextLabelPrivate::setTextWidth( qreal w )
+{
+	if( textWidth != w )
+	{
+		textWidth = w;
+		layoutValid = false;
+	}
+}
+
 
 //
 // TextLabel
@@ -85,13 +124,14 @@ TextLabel::~TextLabel()
 QString
 TextLabel::text() const
 {
-	return d->staticText.text();
+	return d->text;
 }
 
 void
 TextLabel::setText( const QString & text )
 {
-	d->staticText.setText( text );
+	d->text = text;
+	d->layoutValid = false;
 
 	update();
 }
@@ -99,13 +139,14 @@ TextLabel::setText( const QString & text )
 Qt::TextFormat
 TextLabel::textFormat() const
 {
-	return d->staticText.textFormat();
+	return d->format;
 }
 
 void
 TextLabel::setTextFormat( Qt::TextFormat format )
 {
-	d->staticText.setTextFormat( format );
+	d->format = format;
+	d->layoutValid = false;
 
 	update();
 }
@@ -113,13 +154,14 @@ TextLabel::setTextFormat( Qt::TextFormat format )
 QTextOption
 TextLabel::textOption() const
 {
-	return d->staticText.textOption();
+	return d->option;
 }
 
 void
 TextLabel::setTextOption( const QTextOption & textOption )
 {
-	d->staticText.setTextOption( textOption );
+	d->option = textOption;
+	d->layoutValid = false;
 
 	update();
 }
@@ -129,7 +171,7 @@ TextLabel::setFont( const QFont & font )
 {
 	QFrame::setFont( font );
 
-	d->staticText.prepare( QTransform(), font );
+	d->layoutValid = false;
 
 	update();
 }
@@ -150,7 +192,7 @@ TextLabel::setMargin( int margin )
 
 	const QMargins margins = contentsMargins();
 
-	d->staticText.setTextWidth( width() - margins.left() -
+	d->setTextWidth( width() - margins.left() -
 		margins.right() - 2 * frameWidth() - 2 * d->margin );
 
 	update();
@@ -190,12 +232,10 @@ TextLabel::heightForWidth( int w ) const
 	const qreal width = w - 2 * frameWidth() - margins.left() -
 		margins.right() - 2 * d->margin;
 
-	QTextDocument doc;
-	doc.setHtml( d->staticText.text() );
-	doc.setTextWidth( width );
-	doc.setDefaultTextOption( d->staticText.textOption() );
+	const QSizeF size = TextLayoutCache::instance().documentSize(
+		d->key( width ) );
 
-	return doc.size().height() +
+	return size.height() +
 		2 * frameWidth() + margins.top() +
 		margins.bottom() + 2 * d->margin;
 }
@@ -208,12 +248,8 @@ TextLabel::minimumSizeHint() const
 
 	const QMargins margins = contentsMargins();
 
-	QTextDocument doc;
-	doc.setHtml( d->staticText.text() );
-	doc.setDefaultTextOption( d->staticText.textOption() );
-	doc.setTextWidth( fontMetrics().averageCharWidth() * 10 );
-
-	const QSizeF size = doc.size();
+	const QSizeF size = TextLayoutCache::instance().documentSize(
+		d->key( fontMetrics().averageCharWidth() * 10 ) );
 	const int frame = 2 * frameWidth();
 
 	return QSize( size.width() + frame + margins.left() + margins.right() +
@@ -239,7 +275,9 @@ TextLabel::paintEvent( QPaintEvent * e )
 	p.setClipRect( cr );
 	p.setPen( d->color );
 
-	int vAlign = d->staticText.textOption().alignment() & Qt::AlignVertical_Mask;
+	const QStaticText & staticText = d->layout();
+
+	int vAlign = d->option.alignment() & Qt::AlignVertical_Mask;
 
 	QPoint topLeft = cr.topLeft();
 
@@ -247,14 +285,14 @@ TextLabel::paintEvent( QPaintEvent * e )
 	{
 		case Qt::AlignBottom :
 			topLeft = QPoint( topLeft.x() + d->margin,
-				cr.bottomLeft().y() - qRound( d->staticText.size().height() ) -
+				cr.bottomLeft().y() - qRound( staticText.size().height() ) -
 				d->margin );
 		break;
 
 		case Qt::AlignVCenter :
 			topLeft = QPoint( topLeft.x() + d->margin,
 				topLeft.y() + cr.height() / 2 -
-					qRound( d->staticText.size().height() ) / 2 );
+					qRound( staticText.size().height() ) / 2 );
 		break;
 
 		default :
@@ -265,7 +303,7 @@ TextLabel::paintEvent( QPaintEvent * e )
 		break;
 	}
 
-	p.drawStaticText( topLeft, d->staticText );
+	p.drawStaticText( topLeft, staticText );
 }
 
 void
@@ -273,10 +311,19 @@ TextLabel::resizeEvent( QResizeEvent * e )
 {
 	const QMargins margins = contentsMargins();
 
-	d->staticText.setTextWidth( e->size().width() - 2 * frameWidth() -
+	d->setTextWidth( e->size().width() - 2 * frameWidth() -
 		margins.left() - margins.right() - 2 * d->margin );
 
 	e->accept();
 }
 
+void
+TextLabel::changeEvent( QEvent * e )
+{
+	if( e->type() == QEvent::FontChange )
+		d->layoutValid = false;
+
+	QFrame::changeEvent( e );
+}
+
 } /* namespace QtMWidgets */
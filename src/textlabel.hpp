@@ -140,6 +140,7 @@ public:
 protected:
 	void paintEvent( QPaintEvent * e ) override;
 	void resizeEvent( QResizeEvent * e ) override;
+	void changeEvent( QEvent * e ) override;
 
 private:
 	Q_DISABLE_COPY( TextLabel )
@@ -25,6 +25,12 @@ TimePicker::TimePicker( const QTime & time, QWidget * parent )
 {
 }
 
+TimePicker::TimePicker( const DateTimeFormat & format, QWidget * parent )
+	:	DateTimePicker( DATETIMEPICKER_TIME_MIN, QMetaType::QTime,
+			format, parent )
+{
+}
+
 TimePicker::~TimePicker()
 {
 }
@@ -38,6 +38,13 @@ class TimePicker
 public:
 	explicit TimePicker( QWidget * parent = 0 );
 	explicit TimePicker( const QTime & time, QWidget * parent = 0 );
+	/*!
+		Construct picker with sections from the compile-time \a format
+		descriptor, date sections of the format are skipped.
+
+		\sa DateTimeFormat
+	*/
+	explicit TimePicker( const DateTimeFormat & format, QWidget * parent = 0 );
 
 	virtual ~TimePicker();
 }; // class TimePicker
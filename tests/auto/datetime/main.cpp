@@ -14,6 +14,7 @@
 #include <QtMWidgets/DateTimePicker>
 #include <QtMWidgets/DatePicker>
 #include <QtMWidgets/TimePicker>
+#include <QtMWidgets/DateTimeFormat>
 
 #include <QtMWidgets/private/datetimeparser.hpp>
 
@@ -621,6 +622,190 @@ private slots:
 		}
 	}
 
+	void testFields()
+	{
+		for( QDate d( 1999, 1, 1 ); d <= QDate( 2001, 12, 31 ); d = d.addDays( 1 ) )
+		{
+			QVERIFY( QtMWidgets::DateTimeFields::daysInMonth( d.year(), d.month() ) ==
+				d.daysInMonth() );
+			QVERIFY( QtMWidgets::DateTimeFields::dayOfWeek( d.year(), d.month(), d.day() ) ==
+				d.dayOfWeek() );
+		}
+
+		QVERIFY( QtMWidgets::DateTimeFields::daysInMonth( 1900, 2 ) == 28 );
+		QVERIFY( QtMWidgets::DateTimeFields::daysInMonth( 2000, 2 ) == 29 );
+
+		const QDateTime dt( { 2021, 12, 31 }, { 23, 59, 59, 999 }, Qt::UTC );
+		const QtMWidgets::DateTimeFields f =
+			QtMWidgets::DateTimeFields::fromDateTime( dt );
+
+		QVERIFY( f.toDateTime( Qt::UTC ) == dt );
+		QVERIFY( f < DATETIMEPICKER_FIELDS_MAX );
+		QVERIFY( DATETIMEPICKER_FIELDS_MIN < f );
+		QVERIFY( !( f < f ) );
+	}
+
+	void testSignalPolicy()
+	{
+		QtMWidgets::DateTimePicker dt( QDateTime( { 2020, 10, 24 }, { 13, 12 } ) );
+		dt.setFormat( QStringLiteral( "ddd MMMM yyyy hh mm a" ) );
+		dt.setFont( m_font );
+		dt.setMouseTracking( true );
+
+		QVERIFY( dt.signalPolicy() == QtMWidgets::DateTimePicker::EmitOnSettle );
+		QVERIFY( dt.throttleRate() == 10 );
+
+		dt.setSignalPolicy( QtMWidgets::DateTimePicker::EmitLive );
+
+		dt.resize( dt.sizeHint() );
+		dt.show();
+
+		QVERIFY( QTest::qWaitForWindowActive( &dt ) );
+
+		QSignalSpy spy( &dt, &QtMWidgets::DateTimePicker::dateTimeChanged );
+
+		{
+			QPoint p( m_dtSections.at( 0 ), dt.height() / 2 );
+			QTest::mousePress( &dt, Qt::LeftButton, {}, p, 20 );
+			QMouseEvent me( QEvent::MouseMove, p + m_delta,
+				dt.mapToGlobal( p + m_delta ),
+				Qt::LeftButton, Qt::LeftButton, {} );
+			QApplication::sendEvent( &dt, &me );
+
+			QVERIFY( spy.count() == 1 );
+			QVERIFY( dt.dateTime() == QDateTime( { 2020, 10, 25 }, { 13, 12 } ) );
+
+			QTest::qWait( 500 );
+			QTest::mouseRelease( &dt, Qt::LeftButton, {}, p + m_delta, 20 );
+			QTest::qWait( 500 );
+
+			QVERIFY( spy.count() == 1 );
+			QVERIFY( dt.dateTime() == QDateTime( { 2020, 10, 25 }, { 13, 12 } ) );
+		}
+
+		dt.setSignalPolicy( QtMWidgets::DateTimePicker::EmitOnSettle );
+
+		{
+			QPoint p( m_dtSections.at( 0 ), dt.height() / 2 );
+			QTest::mousePress( &dt, Qt::LeftButton, {}, p, 20 );
+			QMouseEvent me( QEvent::MouseMove, p + m_delta,
+				dt.mapToGlobal( p + m_delta ),
+				Qt::LeftButton, Qt::LeftButton, {} );
+			QApplication::sendEvent( &dt, &me );
+
+			QVERIFY( spy.count() == 1 );
+
+			QTest::qWait( 500 );
+			QTest::mouseRelease( &dt, Qt::LeftButton, {}, p + m_delta, 20 );
+			QTest::qWait( 500 );
+
+			QVERIFY( spy.count() == 2 );
+			QVERIFY( dt.dateTime() == QDateTime( { 2020, 10, 26 }, { 13, 12 } ) );
+		}
+	}
+
+	void testThrottledSignalPolicy()
+	{
+		QtMWidgets::DateTimePicker dt( QDateTime( { 2020, 10, 24 }, { 13, 12 } ) );
+		dt.setFormat( QStringLiteral( "ddd MMMM yyyy hh mm a" ) );
+		dt.setFont( m_font );
+		dt.setMouseTracking( true );
+		dt.setSignalPolicy( QtMWidgets::DateTimePicker::EmitThrottled );
+		dt.setThrottleRate( 5 );
+
+		dt.resize( dt.sizeHint() );
+		dt.show();
+
+		QVERIFY( QTest::qWaitForWindowActive( &dt ) );
+
+		QSignalSpy spy( &dt, &QtMWidgets::DateTimePicker::dateTimeChanged );
+
+		QPoint p( m_dtSections.at( 0 ), dt.height() / 2 );
+		QTest::mousePress( &dt, Qt::LeftButton, {}, p, 20 );
+
+		{
+			QMouseEvent me( QEvent::MouseMove, p + m_delta,
+				dt.mapToGlobal( p + m_delta ),
+				Qt::LeftButton, Qt::LeftButton, {} );
+			QApplication::sendEvent( &dt, &me );
+		}
+
+		// First change is emitted at once.
+		QVERIFY( spy.count() == 1 );
+
+		{
+			QMouseEvent me( QEvent::MouseMove, p + m_delta * 2,
+				dt.mapToGlobal( p + m_delta * 2 ),
+				Qt::LeftButton, Qt::LeftButton, {} );
+			QApplication::sendEvent( &dt, &me );
+		}
+
+		// Next change waits for the throttle interval.
+		QVERIFY( spy.count() == 1 );
+
+		QTRY_VERIFY( spy.count() == 2 );
+		QVERIFY( spy.at( 1 ).at( 0 ).toDateTime() ==
+			QDateTime( { 2020, 10, 26 }, { 13, 12 } ) );
+
+		QTest::qWait( 500 );
+		QTest::mouseRelease( &dt, Qt::LeftButton, {}, p + m_delta * 2, 20 );
+		QTest::qWait( 500 );
+
+		// Settled value was emitted already.
+		QVERIFY( spy.count() == 2 );
+		QVERIFY( dt.dateTime() == QDateTime( { 2020, 10, 26 }, { 13, 12 } ) );
+	}
+
+	void testFormatDescriptor()
+	{
+		static constexpr QtMWidgets::DateTimeFormat date( "dd.MM.yyyy" );
+		static constexpr QtMWidgets::DateTimeFormat time( "hh:mm a" );
+
+		static_assert( date.isValid() && date.count() == 3, "" );
+		static_assert( date.field( 0 ) == QtMWidgets::DateTimeFormat::Day &&
+			date.zeroesAdded( 0 ), "" );
+		static_assert( date.field( 2 ) == QtMWidgets::DateTimeFormat::Year, "" );
+		static_assert( time.count() == 3 &&
+			time.field( 0 ) == QtMWidgets::DateTimeFormat::Hour12, "" );
+
+		QtMWidgets::DateTimePicker dt( date );
+
+		QVERIFY( dt.format() == QStringLiteral( "dd.MM.yyyy" ) );
+
+		QtMWidgets::DatePicker d( date );
+
+		QVERIFY( d.format() == QStringLiteral( "dd.MM.yyyy" ) );
+		QVERIFY( d.date() == DATETIMEPICKER_DATE_INITIAL );
+
+		QtMWidgets::TimePicker t( time );
+
+		QVERIFY( t.format() == QStringLiteral( "hh:mm a" ) );
+		QVERIFY( t.time() == DATETIMEPICKER_TIME_MIN );
+
+		QtMWidgets::DateTimeParser parsed( QMetaType::QDateTime );
+		QVERIFY( parsed.parseFormat( QStringLiteral( "dd.MM.yyyy" ) ) );
+
+		QtMWidgets::DateTimeParser loaded( QMetaType::QDateTime, date );
+
+		QVERIFY( loaded.sections.size() == parsed.sections.size() );
+
+		for( int i = 0; i < loaded.sections.size(); ++i )
+		{
+			QVERIFY( loaded.sections.at( i ).type == parsed.sections.at( i ).type );
+			QVERIFY( loaded.sections.at( i ).zeroesAdded ==
+				parsed.sections.at( i ).zeroesAdded );
+		}
+
+		QtMWidgets::DateTimeParser timeOnly( QMetaType::QTime,
+			QtMWidgets::DateTimeFormat( "dd hh mm" ) );
+
+		QVERIFY( timeOnly.sections.size() == 2 );
+
+		const QtMWidgets::DateTimeFormat wrong( "hh hh" );
+
+		QVERIFY( !wrong.isValid() );
+	}
+
 private:
 	QSharedPointer< QtMWidgets::DateTimePicker > m_dt;
 	QSharedPointer< QtMWidgets::DatePicker > m_d;
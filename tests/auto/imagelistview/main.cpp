@@ -0,0 +1,183 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Qt include.
+#include <QObject>
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include <QImage>
+
+// QtMWidgets include.
+#include <QtMWidgets/ImageListView>
+#include <QtMWidgets/ListModel>
+#include <QtMWidgets/MemoryUsage>
+
+
+class TestImageListView
+	:	public QObject
+{
+	Q_OBJECT
+
+private slots:
+
+	void initTestCase()
+	{
+		QVERIFY( m_dir.isValid() );
+
+		for( int i = 0; i < 20; ++i )
+		{
+			QImage image( 400, 200, QImage::Format_RGB32 );
+			image.fill( QColor::fromHsv( i * 15, 255, 255 ) );
+
+			const QString fileName =
+				m_dir.filePath( QStringLiteral( "%1.png" ).arg( i ) );
+
+			QVERIFY( image.save( fileName ) );
+
+			m_files.append( fileName );
+		}
+	}
+
+	void testThumbnails()
+	{
+		QtMWidgets::ImageListView v;
+		v.resize( 400, 300 );
+
+		QtMWidgets::ListModel< QString > model;
+
+		foreach( const QString & f, m_files )
+			model.appendRow( f );
+
+		v.setModel( &model );
+
+		QCOMPARE( v.maxImageSize(), QSize( 256, 256 ) );
+		QCOMPARE( v.thumbnailSize(), QSize( 32, 32 ) );
+		QVERIFY( v.thumbnail( 0 ).isNull() );
+		QVERIFY( !v.isImageLoaded( 0 ) );
+
+		v.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &v ) );
+
+		QTRY_VERIFY( !v.thumbnail( 0 ).isNull() );
+		QCOMPARE( v.thumbnail( 0 ).size(), QSize( 32, 16 ) );
+
+		QTRY_VERIFY( v.isImageLoaded( 0 ) );
+
+		// Row height follows aspect ratio of the image.
+		QTRY_COMPARE( v.visualRect( 0 ).height(), 128 );
+
+		// Thumbnails are prefetched below the viewport.
+		QTRY_VERIFY( !v.thumbnail( 10 ).isNull() );
+
+		QVERIFY( v.memoryUsage().bytes( QtMWidgets::MemoryUsage::Caches ) >=
+			256 * 128 * 4 );
+
+		QTest::ignoreMessage( QtWarningMsg,
+			"QtMWidgets::ImageListView::setMaxImageSize: "
+			"size should not be empty" );
+
+		v.setMaxImageSize( QSize() );
+
+		QCOMPARE( v.maxImageSize(), QSize( 256, 256 ) );
+
+		v.setMaxImageSize( QSize( 128, 128 ) );
+
+		QVERIFY( !v.isImageLoaded( 0 ) );
+		QTRY_COMPARE( v.visualRect( 0 ).height(), 64 );
+		QTRY_VERIFY( v.isImageLoaded( 0 ) );
+	}
+
+	void testEviction()
+	{
+		QtMWidgets::ImageListView v;
+		v.resize( 400, 300 );
+		v.setImageCacheBytes( 256 * 128 * 4 * 4 );
+
+		QtMWidgets::ListModel< QString > model;
+
+		foreach( const QString & f, m_files )
+			model.appendRow( f );
+
+		v.setModel( &model );
+		v.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &v ) );
+
+		QTRY_VERIFY( v.isImageLoaded( 0 ) );
+
+		v.scrollTo( 19 );
+
+		QTRY_VERIFY( v.isImageLoaded( 19 ) );
+
+		// Images far from the viewport are evicted, thumbnails are kept.
+		QTRY_VERIFY( !v.isImageLoaded( 0 ) );
+		QVERIFY( !v.thumbnail( 0 ).isNull() );
+
+		QVERIFY( v.memoryUsage().bytes( QtMWidgets::MemoryUsage::Caches ) <=
+			v.imageCacheBytes() + 20 * 32 * 32 * 4 );
+	}
+
+	void testPruning()
+	{
+		QtMWidgets::ImageListView v;
+		v.resize( 400, 300 );
+
+		QtMWidgets::ListModel< QString > model;
+
+		foreach( const QString & f, m_files )
+			model.appendRow( f );
+
+		v.setModel( &model );
+		v.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &v ) );
+
+		QTRY_VERIFY( v.isImageLoaded( 0 ) );
+
+		// Images of the removed files are dropped.
+		model.removeRows( 1, model.rowCount() - 1 );
+
+		QTRY_VERIFY( v.memoryUsage().bytes( QtMWidgets::MemoryUsage::Caches ) <
+			2 * 256 * 128 * 4 );
+		QVERIFY( v.isImageLoaded( 0 ) );
+
+		model.reset();
+
+		QTRY_VERIFY( v.memoryUsage().bytes(
+			QtMWidgets::MemoryUsage::Caches ) == 0 );
+	}
+
+	void testMissingFile()
+	{
+		QtMWidgets::ImageListView v;
+		v.resize( 400, 300 );
+
+		QtMWidgets::ListModel< QString > model;
+		model.appendRow( m_dir.filePath( QStringLiteral( "missing.png" ) ) );
+		model.appendRow( m_files.first() );
+
+		v.setModel( &model );
+		v.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &v ) );
+
+		QTRY_VERIFY( v.isImageLoaded( 1 ) );
+
+		QVERIFY( v.thumbnail( 0 ).isNull() );
+		QVERIFY( !v.isImageLoaded( 0 ) );
+		QCOMPARE( v.visualRect( 0 ).height(), 256 );
+	}
+
+private:
+	QTemporaryDir m_dir;
+	QStringList m_files;
+};
+
+
+QTEST_MAIN( TestImageListView )
+
+#include "main.moc"
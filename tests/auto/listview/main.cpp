@@ -8,10 +8,15 @@
 #include <QObject>
 #include <QtTest/QtTest>
 #include <QSharedPointer>
+#include <QAccessible>
 
 // QtMWidgets include.
 #include <QtMWidgets/AbstractListView>
 #include <QtMWidgets/AbstractListModel>
+#include <QtMWidgets/MemoryUsage>
+#include <QtMWidgets/ListFilterProxyModel>
+#include <QtMWidgets/private/abstractscrollarea_p.hpp>
+#include <QtMWidgets/private/idlescheduler.hpp>
 
 
 class ListView
@@ -20,6 +25,9 @@ class ListView
 public:
 	explicit ListView( QWidget * parent = nullptr )
 		:	QtMWidgets::AbstractListView< QColor > ( parent )
+		,	measured( 0 )
+		,	drawn( 0 )
+		,	scrolled( 0 )
 	{
 		setModel( new QtMWidgets::ListModel< QColor > () );
 	}
@@ -29,10 +37,66 @@ public:
 		QtMWidgets::AbstractListView< QColor >::setViewportMargins( m );
 	}
 
+	qint64 helpersMemoryUsage() const
+	{
+		return d->helpersMemoryUsage();
+	}
+
+	int areaHeight() const
+	{
+		return scrolledAreaSize().height();
+	}
+
+	int areaWidth() const
+	{
+		return scrolledAreaSize().width();
+	}
+
+	void recalculate()
+	{
+		recalculateSize();
+	}
+
+	void jump( const QPoint & topLeft )
+	{
+		jumpToPosition( topLeft );
+	}
+
+	//! Count of rowHeightForWidth() calls.
+	mutable int measured;
+	//! Count of drawRow() calls.
+	int drawn;
+	//! Count of scrollContentsBy() calls.
+	int scrolled;
+
 protected:
+	int rowHeightForWidth( int row, int width ) const override
+	{
+		++measured;
+
+		const int h = QtMWidgets::AbstractListView< QColor >::rowHeightForWidth(
+			row, width );
+
+		return ( model()->data( row ) == QColor( Qt::black ) ? h * 2 : h );
+	}
+
+	void scrollContentsBy( int dx, int dy ) override
+	{
+		++scrolled;
+
+		QtMWidgets::AbstractListView< QColor >::scrollContentsBy( dx, dy );
+	}
+
+	QString accessibleRowText( int row ) const override
+	{
+		return QString::number( row );
+	}
+
 	void drawRow( QPainter * painter,
 		const QRect & rect, int row ) override
 	{
+		++drawn;
+
 		const QColor & c = model()->data( row );
 
 		painter->setPen( Qt::black );
@@ -48,6 +112,41 @@ protected:
 };
 
 
+//! List view with section of every ten rows.
+class SectionListView
+	:	public ListView
+{
+public:
+	SectionListView()
+		:	headersDrawn( 0 )
+	{
+	}
+
+	//! Count of drawSectionHeader() calls.
+	int headersDrawn;
+
+protected:
+	bool isSectionStart( int row ) const override
+	{
+		return ( row % 10 == 0 );
+	}
+
+	int sectionHeaderHeightForWidth( int, int ) const override
+	{
+		return 20;
+	}
+
+	void drawSectionHeader( QPainter * painter,
+		const QRect & rect, int row ) override
+	{
+		++headersDrawn;
+
+		painter->fillRect( rect, Qt::lightGray );
+		painter->drawText( rect, QString::number( row / 10 ) );
+	}
+};
+
+
 class TestListView
 	:	public QObject
 {
@@ -273,6 +372,636 @@ private slots:
 		}
 	}
 
+	void testLazyHelpers()
+	{
+		ListView w;
+
+		for( int i = 0; i < m_data.size(); ++i )
+			w.model()->appendRow( m_data.at( i ) );
+
+		w.setBlurPolicy( QtMWidgets::AbstractScrollArea::BlurBothDirections );
+		w.resize( 100, 200 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		QVERIFY( w.helpersMemoryUsage() == 0 );
+
+		w.scrollTo( w.model()->rowCount() - 1,
+			QtMWidgets::AbstractListViewBase::PositionAtBottom );
+
+		const qint64 scrolled = w.helpersMemoryUsage();
+
+		QVERIFY( scrolled > 0 );
+
+		w.scrollTo( 0, QtMWidgets::AbstractListViewBase::PositionAtTop );
+
+		QVERIFY( w.helpersMemoryUsage() == scrolled );
+
+		const auto r = w.visualRect( 0 );
+
+		QTest::mousePress( &w, Qt::LeftButton, {}, r.center(), 20 );
+		QMouseEvent me( QEvent::MouseMove, r.center() + QPoint( 0, r.height() ),
+			w.mapToGlobal( r.center() + QPoint( 0, r.height() ) ),
+			Qt::LeftButton, Qt::LeftButton, {} );
+		QApplication::sendEvent( &w, &me );
+		QTest::mouseRelease( &w, Qt::LeftButton, {},
+			r.center() + QPoint( 0, r.height() ), 20 );
+
+		QVERIFY( w.helpersMemoryUsage() > scrolled );
+
+		QTest::qWait( 320 );
+	}
+
+	void testInteracting()
+	{
+		ListView w;
+
+		for( int i = 0; i < m_data.size(); ++i )
+			w.model()->appendRow( m_data.at( i ) );
+
+		w.resize( 100, 200 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		QVERIFY( !w.isInteracting() );
+
+		QSignalSpy spy( &w, &QtMWidgets::AbstractScrollArea::interactingChanged );
+
+		const auto r = w.visualRect( 0 );
+
+		QTest::mousePress( &w, Qt::LeftButton, {}, r.center(), 20 );
+
+		QVERIFY( !w.isInteracting() );
+
+		QMouseEvent me( QEvent::MouseMove, r.center() - QPoint( 0, r.height() ),
+			w.mapToGlobal( r.center() - QPoint( 0, r.height() ) ),
+			Qt::LeftButton, Qt::LeftButton, {} );
+		QApplication::sendEvent( &w, &me );
+
+		QVERIFY( w.isInteracting() );
+		QVERIFY( spy.count() == 1 );
+		QVERIFY( spy.at( 0 ).at( 0 ).toBool() );
+
+		QTest::qWait( 500 );
+		QTest::mouseRelease( &w, Qt::LeftButton, {},
+			r.center() - QPoint( 0, r.height() ), 20 );
+
+		QVERIFY( !w.isInteracting() );
+		QVERIFY( spy.count() == 2 );
+		QVERIFY( !spy.at( 1 ).at( 0 ).toBool() );
+	}
+
+	void testChangeHint()
+	{
+		ListView w;
+
+		for( int i = 0; i < m_data.size(); ++i )
+			w.model()->appendRow( m_data.at( i ) );
+
+		w.resize( 100, 200 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		QSignalSpy spy( w.model(), &QtMWidgets::ListModel< QColor >::dataChanged );
+
+		const int height = w.areaHeight();
+		const int rowHeight = w.visualRect( 0 ).height();
+
+		w.measured = 0;
+		w.model()->setData( 1, Qt::darkRed,
+			QtMWidgets::AbstractListModel::PaintOnlyChange );
+
+		QVERIFY( spy.count() == 1 );
+		QVERIFY( spy.at( 0 ).at( 2 ).value< QtMWidgets::AbstractListModel::ChangeHint >() ==
+			QtMWidgets::AbstractListModel::PaintOnlyChange );
+		QVERIFY( w.measured < w.model()->rowCount() );
+		QVERIFY( w.areaHeight() == height );
+
+		// Only changed row is measured again.
+		w.measured = 0;
+		w.model()->setData( w.model()->rowCount() - 1, Qt::black );
+
+		QVERIFY( spy.count() == 2 );
+		QVERIFY( spy.at( 1 ).at( 2 ).value< QtMWidgets::AbstractListModel::ChangeHint >() ==
+			QtMWidgets::AbstractListModel::LayoutChange );
+		QVERIFY( w.measured < w.model()->rowCount() );
+		QVERIFY( w.areaHeight() == height + rowHeight );
+
+		w.model()->insertRow( 0, Qt::black );
+
+		QVERIFY( w.areaHeight() == height + rowHeight * 3 );
+
+		w.model()->removeRow( 0 );
+
+		QVERIFY( w.areaHeight() == height + rowHeight );
+
+		w.measured = 0;
+		w.recalculate();
+
+		QVERIFY( w.measured >= w.model()->rowCount() );
+		QVERIFY( w.areaHeight() == height + rowHeight );
+
+		// Hint defaults to layout change.
+		emit w.model()->dataChanged( 0, 0 );
+
+		QVERIFY( spy.count() == 3 );
+		QVERIFY( spy.at( 2 ).at( 2 ).value< QtMWidgets::AbstractListModel::ChangeHint >() ==
+			QtMWidgets::AbstractListModel::LayoutChange );
+
+		// Paint-only change of the rows out of the viewport measures nothing.
+		for( int i = 0; i < 1000; ++i )
+			w.model()->appendRow( Qt::white );
+
+		QTRY_VERIFY( QtMWidgets::IdleScheduler::instance()->pendingCount() == 0 );
+
+		w.measured = 0;
+
+		for( int i = 500; i < w.model()->rowCount(); ++i )
+			w.model()->setData( i, Qt::red,
+				QtMWidgets::AbstractListModel::PaintOnlyChange );
+
+		QVERIFY( w.measured == 0 );
+	}
+
+	void testHeightEstimation()
+	{
+		ListView w;
+		w.setHeightEstimation( true );
+
+		QVERIFY( w.heightEstimation() );
+
+		// Every tenth row is black and twice higher.
+		for( int i = 0; i < 2000; ++i )
+			w.model()->appendRow( i % 10 == 0 ?
+				QColor( Qt::black ) : QColor( Qt::white ) );
+
+		w.resize( 100, 200 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		const int rowHeight = w.visualRect( 1 ).height();
+		const int exact = rowHeight * 2200;
+
+		QTRY_VERIFY( QtMWidgets::IdleScheduler::instance()->pendingCount() == 0 );
+		QVERIFY( w.areaHeight() == exact );
+
+		w.scrollTo( 1000, QtMWidgets::AbstractListViewBase::PositionAtTop );
+
+		const int top = w.visualRect( 1000 ).top();
+
+		// Only rows near the viewport are measured at once.
+		w.measured = 0;
+		w.resize( 150, 200 );
+
+		QVERIFY( w.measured < w.model()->rowCount() );
+		QVERIFY( w.visualRect( 1000 ).top() == top );
+		QVERIFY( w.topLeftPointShownArea().y() == rowHeight * 1100 - top );
+
+		QTRY_VERIFY( QtMWidgets::IdleScheduler::instance()->pendingCount() == 0 );
+		QVERIFY( w.areaHeight() == exact );
+		QVERIFY( w.visualRect( 1000 ).top() == top );
+		QVERIFY( w.topLeftPointShownArea().y() == rowHeight * 1100 - top );
+	}
+
+	void testRowCaching()
+	{
+		ListView w;
+		w.setRowCaching( true );
+
+		QVERIFY( w.rowCaching() );
+
+		for( int i = 0; i < 100; ++i )
+			w.model()->appendRow( Qt::white );
+
+		w.resize( 100, 200 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		// Rows below the viewport are rendered in idle time.
+		QTRY_VERIFY( QtMWidgets::IdleScheduler::instance()->pendingCount() == 0 );
+
+		const int rowHeight = w.visualRect( 0 ).height();
+		const int visible = 200 / rowHeight + 1;
+
+		QVERIFY( w.drawn > visible );
+		QVERIFY( w.memoryUsage().bytes( QtMWidgets::MemoryUsage::Caches ) > 0 );
+
+		// Repaint and scroll by one row are blits from the cache.
+		w.drawn = 0;
+		w.viewport()->repaint();
+
+		QVERIFY( w.drawn == 0 );
+
+		w.scrollTo( 1, QtMWidgets::AbstractListViewBase::PositionAtTop );
+		w.viewport()->repaint();
+
+		QVERIFY( w.drawn == 0 );
+
+		// Changed row is rendered again.
+		w.model()->setData( 1, Qt::red,
+			QtMWidgets::AbstractListModel::PaintOnlyChange );
+		w.viewport()->repaint();
+
+		QVERIFY( w.drawn == 1 );
+
+		// Inserted and removed rows don't drop the other cached rows.
+		w.drawn = 0;
+		w.model()->insertRow( 2, Qt::green );
+		w.viewport()->repaint();
+
+		QVERIFY( w.drawn <= 2 );
+
+		w.drawn = 0;
+		w.model()->removeRow( 2 );
+		w.viewport()->repaint();
+
+		QVERIFY( w.drawn <= 1 );
+
+		w.drawn = 0;
+		w.model()->moveRow( 2, 4 );
+		w.viewport()->repaint();
+
+		QVERIFY( w.drawn <= 4 );
+
+		w.setRowCaching( false );
+		w.drawn = 0;
+		w.viewport()->repaint();
+
+		QVERIFY( w.drawn >= visible - 1 );
+	}
+
+	void testScrubber()
+	{
+		ListView w;
+		w.model()->insertRows( 0, 100000 );
+		w.setScrubberEnabled( true );
+		w.setRowLabelFunction(
+			[] ( int row ) { return QString::number( row / 1000 ); } );
+
+		QVERIFY( w.isScrubberEnabled() );
+
+		w.resize( 100, 200 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		QWidget * scrubber =
+			w.findChild< QWidget* > ( QLatin1String( "qt_scrollarea_scrubber" ) );
+		QWidget * label = w.findChild< QWidget* > (
+			QLatin1String( "qt_scrollarea_scrubber_label" ) );
+
+		QVERIFY( scrubber && label );
+		QVERIFY( scrubber->isVisible() );
+		QVERIFY( !label->isVisible() );
+
+		// Jump to the last row doesn't measure intermediate rows.
+		w.measured = 0;
+
+		QTest::mousePress( scrubber, Qt::LeftButton, {},
+			QPoint( scrubber->width() / 2, scrubber->height() - 1 ) );
+
+		QVERIFY( w.isInteracting() );
+		QVERIFY( label->isVisible() );
+		QVERIFY( w.measured < 1000 );
+		QVERIFY( w.topLeftPointShownArea().y() ==
+			w.areaHeight() - w.viewport()->height() );
+
+		QTest::qWait( 100 );
+
+		QVERIFY( !w.visualRect( 99999 ).isNull() );
+
+		QTest::mouseRelease( scrubber, Qt::LeftButton, {},
+			QPoint( scrubber->width() / 2, scrubber->height() - 1 ) );
+
+		QVERIFY( !w.isInteracting() );
+		QVERIFY( !label->isVisible() );
+
+		// Jump to the top.
+		QTest::mousePress( scrubber, Qt::LeftButton, {},
+			QPoint( scrubber->width() / 2, 0 ) );
+		QTest::mouseRelease( scrubber, Qt::LeftButton, {},
+			QPoint( scrubber->width() / 2, 0 ) );
+
+		QVERIFY( w.topLeftPointShownArea().y() == 0 );
+		QVERIFY( !w.visualRect( 0 ).isNull() );
+
+		w.setScrubberEnabled( false );
+
+		QVERIFY( !scrubber->isVisible() );
+	}
+
+	void testSections()
+	{
+		SectionListView w;
+		w.model()->insertRows( 0, 1000 );
+
+		w.resize( 100, 200 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		const int rowHeight = w.visualRect( 1 ).height();
+
+		QVERIFY( w.areaHeight() == rowHeight * 1000 + 20 * 100 );
+		QVERIFY( w.sectionAt( 0 ) == 0 );
+		QVERIFY( w.sectionAt( 15 ) == 10 );
+		QVERIFY( w.sectionAt( 999 ) == 990 );
+		QVERIFY( w.currentSection() == 0 );
+
+		// Header is laid out between the rows.
+		w.scrollTo( 9, QtMWidgets::AbstractListViewBase::PositionAtTop );
+
+		QVERIFY( w.currentSection() == 0 );
+		QVERIFY( w.visualRect( 10 ).top() ==
+			w.visualRect( 9 ).bottom() + 1 + 20 );
+
+		// Sticky header covers rows under it.
+		QVERIFY( w.rowAt( QPoint( 50, 5 ) ) == -1 );
+
+		// Next header pushes the sticky one up.
+		w.scrollTo( 10, QtMWidgets::AbstractListViewBase::PositionAtTop );
+		w.jump( w.topLeftPointShownArea() - QPoint( 0, 25 ) );
+
+		QVERIFY( w.currentSection() == 0 );
+		QVERIFY( w.rowAt( QPoint( 50, 2 ) ) == -1 );
+		QVERIFY( w.rowAt( QPoint( 50, w.visualRect( 10 ).top() + 1 ) ) == 10 );
+
+		w.scrollTo( 25, QtMWidgets::AbstractListViewBase::PositionAtTop );
+
+		QVERIFY( w.currentSection() == 20 );
+
+		// Sticky header is drawn from the cache.
+		w.viewport()->repaint();
+
+		const int drawn = w.headersDrawn;
+
+		w.viewport()->repaint();
+
+		QVERIFY( w.headersDrawn - drawn <= 1 );
+
+		// Changed row starts a new section.
+		w.model()->removeRow( 20 );
+
+		QVERIFY( w.sectionAt( 25 ) == 20 );
+		QVERIFY( w.areaHeight() == rowHeight * 999 + 20 * 100 );
+
+		// Sections after the inserted rows are shifted, not scanned again.
+		w.model()->insertRows( 500, 5 );
+
+		QVERIFY( w.sectionAt( 506 ) == 500 );
+		QVERIFY( w.sectionAt( 999 ) == 994 );
+	}
+
+	void testAnimatedScrollTo()
+	{
+		ListView w;
+		w.model()->insertRows( 0, 100000 );
+
+		w.resize( 100, 200 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		const int rowHeight = w.visualRect( 0 ).height();
+
+		// Rows passed over are not measured.
+		w.measured = 0;
+		w.animateScrollTo( 90000,
+			QtMWidgets::AbstractListViewBase::PositionAtTop );
+
+		QVERIFY( w.isInteracting() );
+
+		QTRY_VERIFY( !w.isInteracting() );
+
+		QVERIFY( w.measured < 1000 );
+		QVERIFY( !w.visualRect( 90000 ).isNull() );
+		QVERIFY( w.topLeftPointShownArea().y() == rowHeight * 90000 + 1 );
+
+		// Not animated scroll uses heights index too.
+		w.measured = 0;
+		w.scrolled = 0;
+		w.scrollTo( 10, QtMWidgets::AbstractListViewBase::PositionAtTop );
+
+		QVERIFY( !w.isInteracting() );
+		QVERIFY( w.measured < 1000 );
+		QVERIFY( w.scrolled == 1 );
+		QVERIFY( w.topLeftPointShownArea().y() == rowHeight * 10 + 1 );
+
+		// Touch stops animation.
+		w.animateScrollTo( 20, QtMWidgets::AbstractListViewBase::PositionAtTop );
+
+		QVERIFY( w.isInteracting() );
+
+		QTest::mousePress( &w, Qt::LeftButton, {}, w.rect().center() );
+
+		QVERIFY( w.topLeftPointShownArea().y() < rowHeight * 20 + 1 );
+
+		QTest::mouseRelease( &w, Qt::LeftButton, {}, w.rect().center() );
+
+		QVERIFY( !w.isInteracting() );
+	}
+
+	void testHorizontal()
+	{
+		ListView w;
+		w.model()->insertRows( 0, 1000 );
+		w.setOrientation( Qt::Horizontal );
+
+		w.resize( 200, 100 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		const QRect first = w.visualRect( 0 );
+		const int rowWidth = first.width();
+
+		// Rows are laid out from left to right.
+		QVERIFY( first.height() == w.viewport()->height() );
+		QVERIFY( w.visualRect( 1 ).left() == first.right() + 1 );
+		QVERIFY( w.rowAt( w.visualRect( 1 ).center() ) == 1 );
+		QVERIFY( w.areaHeight() == w.viewport()->height() );
+		QVERIFY( w.areaWidth() == rowWidth * 1000 );
+
+		w.measured = 0;
+		w.scrollTo( 500, QtMWidgets::AbstractListViewBase::PositionAtTop );
+
+		QVERIFY( w.measured < 1000 );
+		QVERIFY( w.topLeftPointShownArea().y() == 0 );
+		QVERIFY( w.topLeftPointShownArea().x() == rowWidth * 500 + 1 );
+		QVERIFY( !w.visualRect( 500 ).isNull() );
+		QVERIFY( w.visualRect( 499 ).isNull() );
+
+		// First visible row stays when orientation changed.
+		w.setOrientation( Qt::Vertical );
+
+		QVERIFY( w.topLeftPointShownArea().x() == 0 );
+		QVERIFY( w.areaWidth() == w.viewport()->width() );
+		QVERIFY( w.visualRect( 501 ).top() == w.visualRect( 500 ).bottom() + 1 );
+	}
+
+	void testAccessibility()
+	{
+		ListView w;
+		w.model()->insertRows( 0, 100000 );
+
+		w.resize( 100, 200 );
+		w.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &w ) );
+
+		QAccessibleInterface * iface = QAccessible::queryAccessibleInterface( &w );
+
+		QVERIFY( iface );
+		QVERIFY( iface->role() == QAccessible::List );
+		QVERIFY( iface->tableInterface() );
+
+		// Count of rows is known without creating them.
+		QVERIFY( iface->tableInterface()->rowCount() == 100000 );
+
+		// Only visible rows are children.
+		const int rowHeight = w.visualRect( 0 ).height();
+
+		QVERIFY( iface->childCount() > 0 );
+		QVERIFY( iface->childCount() <= 200 / rowHeight + 1 );
+
+		QAccessibleInterface * row = iface->child( 1 );
+
+		QVERIFY( row );
+		QVERIFY( row->text( QAccessible::Name ) == QStringLiteral( "1" ) );
+		QVERIFY( row->tableCellInterface()->rowIndex() == 1 );
+		QVERIFY( iface->indexOfChild( row ) == 1 );
+		QVERIFY( !row->state().offscreen );
+
+		// Far row is created on demand.
+		QAccessibleInterface * far = iface->tableInterface()->cellAt( 99999, 0 );
+
+		QVERIFY( far );
+		QVERIFY( far->text( QAccessible::Name ) == QStringLiteral( "99999" ) );
+		QVERIFY( far->state().offscreen );
+		QVERIFY( iface->indexOfChild( far ) == -1 );
+
+		w.scrollTo( 50000, QtMWidgets::AbstractListViewBase::PositionAtTop );
+
+		QVERIFY( iface->child( 0 )->text( QAccessible::Name ) ==
+			QStringLiteral( "50000" ) );
+	}
+
+	void testFilterProxy()
+	{
+		QtMWidgets::ListModel< int > source;
+
+		for( int i = 0; i < 10000; ++i )
+			source.appendRow( i );
+
+		QtMWidgets::ListFilterProxyModel< int > proxy;
+		proxy.setSourceModel( &source );
+
+		QVERIFY( proxy.rowCount() == 10000 );
+
+		proxy.setFilter( [] ( const int & v ) { return v % 2 == 0; } );
+
+		QVERIFY( proxy.isFiltering() );
+		QTRY_VERIFY( !proxy.isFiltering() );
+		QVERIFY( proxy.rowCount() == 5000 );
+		QVERIFY( proxy.mapToSource( 1 ) == 2 );
+		QVERIFY( proxy.mapFromSource( 3 ) == -1 );
+		QVERIFY( proxy.data( 2 ) == 4 );
+
+		// Refined query checks previous result and removes rows incrementally.
+		QSignalSpy removed( &proxy, &QtMWidgets::AbstractListModel::rowsRemoved );
+		QSignalSpy reset( &proxy, &QtMWidgets::AbstractListModel::modelReset );
+
+		proxy.setFilter( [] ( const int & v ) { return v % 2 == 0 && v < 100; },
+			true );
+
+		QTRY_VERIFY( !proxy.isFiltering() );
+		QVERIFY( proxy.rowCount() == 50 );
+		QVERIFY( removed.count() == 1 );
+		QVERIFY( reset.count() == 0 );
+
+		// Stale query is dropped.
+		proxy.setFilter( [] ( const int & v ) { return v < 10; } );
+		proxy.setFilter( [] ( const int & v ) { return v < 20; } );
+
+		QTRY_VERIFY( !proxy.isFiltering() );
+		QVERIFY( proxy.rowCount() == 20 );
+		QVERIFY( reset.count() == 0 );
+
+		// Changes of the source are mapped.
+		source.setData( 5, 1000 );
+
+		QVERIFY( proxy.rowCount() == 19 );
+		QVERIFY( proxy.mapFromSource( 5 ) == -1 );
+
+		source.insertRow( 0, 3 );
+
+		QVERIFY( proxy.rowCount() == 20 );
+		QVERIFY( proxy.data( 0 ) == 3 );
+		QVERIFY( proxy.mapToSource( 1 ) == 1 );
+
+		source.removeRow( 0 );
+
+		QVERIFY( proxy.rowCount() == 19 );
+		QVERIFY( proxy.data( 0 ) == 0 );
+
+		QVERIFY( proxy.setData( 0, 7 ) );
+		QVERIFY( source.data( 0 ) == 7 );
+		QVERIFY( proxy.data( 0 ) == 7 );
+
+		// Rows are inserted only into the source.
+		QSignalSpy inserted( &proxy, &QtMWidgets::AbstractListModel::rowsInserted );
+
+		QTest::ignoreMessage( QtWarningMsg,
+			"ListFilterProxyModel::insertRow: insert rows into the source model." );
+		QVERIFY( !proxy.appendRow( 1 ) );
+
+		QTest::ignoreMessage( QtWarningMsg,
+			"ListFilterProxyModel::insertRow: insert rows into the source model." );
+		QVERIFY( !static_cast< QtMWidgets::ListModel< int >* > ( &proxy )->
+			insertRow( 0, 1 ) );
+
+		QVERIFY( inserted.count() == 0 );
+		QVERIFY( proxy.rowCount() == 19 );
+
+		proxy.clearFilter();
+
+		QVERIFY( proxy.rowCount() == 10000 );
+	}
+
+	void testMemoryUsage()
+	{
+		QWidget window;
+		window.setObjectName( QLatin1String( "window" ) );
+
+		ListView * w = new ListView( &window );
+
+		const qint64 emptyModel = w->model()->memoryUsage().total();
+		const qint64 emptyView = w->memoryUsage().total();
+
+		for( int i = 0; i < m_data.size(); ++i )
+			w->model()->appendRow( m_data.at( i ) );
+
+		QVERIFY( w->model()->memoryUsage().total() > emptyModel );
+		QVERIFY( w->memoryUsage().total() - emptyView ==
+			w->model()->memoryUsage().total() - emptyModel );
+
+		const QtMWidgets::MemoryUsage tree =
+			QtMWidgets::MemoryUsage::ofTree( &window );
+
+		QVERIFY( tree.bytes( QtMWidgets::MemoryUsage::ChildWidgets ) >=
+			QtMWidgets::MemoryUsage::ofTree( w ).total() );
+
+		const QString dump = QtMWidgets::MemoryUsage::dump( &window );
+
+		QVERIFY( dump.startsWith( QLatin1String( "QWidget \"window\"" ) ) );
+		QVERIFY( dump.contains( QLatin1String( "  QtMWidgets::AbstractListViewBase" ) ) );
+	}
+
 private:
 	QSharedPointer< ListView > m_w;
 	QVector< QColor > m_data;
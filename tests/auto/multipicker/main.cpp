@@ -0,0 +1,138 @@
+
+/*
+	SPDX-FileCopyrightText: 2014-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Qt include.
+#include <QObject>
+#include <QtTest/QtTest>
+#include <QSharedPointer>
+
+// QtMWidgets include.
+#include <QtMWidgets/MultiPicker>
+
+
+class TestMultiPicker
+	:	public QObject
+{
+	Q_OBJECT
+
+private slots:
+
+	void initTestCase()
+	{
+		m_picker.reset( new QtMWidgets::MultiPicker );
+
+		m_picker->setMouseTracking( true );
+
+		m_font = m_picker->font();
+		m_font.setBold( true );
+		m_picker->setFont( m_font );
+
+		QFontMetrics fm( m_font );
+		int height = fm.boundingRect( QLatin1String( "AM" ) ).height();
+		height += height / 3;
+
+		m_delta = QPoint( 0, -height );
+	}
+
+	void testColumns()
+	{
+		QVERIFY( m_picker->columnCount() == 0 );
+
+		QStringList values;
+
+		for( int i = 0; i < 100; ++i )
+			values.append( QString::number( i ) );
+
+		QVERIFY( m_picker->addColumn( values ) == 0 );
+		QVERIFY( m_picker->addColumn( { QStringLiteral( "." ),
+			QStringLiteral( "0" ), QStringLiteral( "5" ) } ) == 1 );
+		QVERIFY( m_picker->addColumn( { QStringLiteral( "kg" ),
+			QStringLiteral( "lb" ) } ) == 2 );
+
+		QVERIFY( m_picker->columnCount() == 3 );
+		QVERIFY( m_picker->count( 0 ) == 100 );
+		QVERIFY( m_picker->count( 2 ) == 2 );
+		QVERIFY( m_picker->currentIndex( 0 ) == 0 );
+		QVERIFY( m_picker->currentText( 2 ) == QStringLiteral( "kg" ) );
+		QVERIFY( m_picker->currentIndex( 3 ) == -1 );
+
+		QSignalSpy spy( m_picker.data(), &QtMWidgets::MultiPicker::currentIndexChanged );
+
+		m_picker->setCurrentIndex( 0, 70 );
+
+		QVERIFY( spy.count() == 1 );
+		QVERIFY( spy.at( 0 ).at( 0 ).toInt() == 0 );
+		QVERIFY( spy.at( 0 ).at( 1 ).toInt() == 70 );
+		QVERIFY( m_picker->currentText( 0 ) == QStringLiteral( "70" ) );
+
+		m_picker->setItems( 1, { QStringLiteral( "." ), QStringLiteral( "0" ) } );
+
+		QVERIFY( m_picker->count( 1 ) == 2 );
+		QVERIFY( m_picker->currentIndex( 1 ) == 0 );
+	}
+
+	void testScroll()
+	{
+		m_picker->resize( m_picker->sizeHint() );
+		m_picker->show();
+
+		QVERIFY( QTest::qWaitForWindowActive( m_picker.data() ) );
+
+		QSignalSpy spy( m_picker.data(), &QtMWidgets::MultiPicker::currentIndexChanged );
+
+		{
+			QPoint p( 5, m_picker->height() / 2 );
+			QTest::mousePress( m_picker.data(), Qt::LeftButton, {}, p, 20 );
+			QMouseEvent me( QEvent::MouseMove, p + m_delta,
+				m_picker->mapToGlobal( p + m_delta ),
+				Qt::LeftButton, Qt::LeftButton, {} );
+			QApplication::sendEvent( m_picker.data(), &me );
+			QTest::qWait( 500 );
+			QTest::mouseRelease( m_picker.data(), Qt::LeftButton, {}, p + m_delta, 20 );
+			QTest::qWait( 500 );
+
+			QVERIFY( m_picker->currentIndex( 0 ) == 71 );
+			QVERIFY( m_picker->currentIndex( 2 ) == 0 );
+		}
+
+		{
+			QPoint p( m_picker->width() - 5, m_picker->height() / 2 );
+			QTest::mousePress( m_picker.data(), Qt::LeftButton, {}, p, 20 );
+			QMouseEvent me( QEvent::MouseMove, p + m_delta,
+				m_picker->mapToGlobal( p + m_delta ),
+				Qt::LeftButton, Qt::LeftButton, {} );
+			QApplication::sendEvent( m_picker.data(), &me );
+			QTest::qWait( 500 );
+			QTest::mouseRelease( m_picker.data(), Qt::LeftButton, {}, p + m_delta, 20 );
+			QTest::qWait( 500 );
+
+			QVERIFY( m_picker->currentIndex( 0 ) == 71 );
+			QVERIFY( m_picker->currentText( 2 ) == QStringLiteral( "lb" ) );
+		}
+
+		QVERIFY( spy.count() == 2 );
+		QVERIFY( spy.at( 1 ).at( 0 ).toInt() == 2 );
+
+		m_picker->removeColumn( 1 );
+
+		QVERIFY( m_picker->columnCount() == 2 );
+		QVERIFY( m_picker->currentText( 1 ) == QStringLiteral( "lb" ) );
+
+		m_picker->clear();
+
+		QVERIFY( m_picker->columnCount() == 0 );
+	}
+
+private:
+	QSharedPointer< QtMWidgets::MultiPicker > m_picker;
+	QFont m_font;
+	QPoint m_delta;
+};
+
+
+QTEST_MAIN( TestMultiPicker )
+
+#include "main.moc"
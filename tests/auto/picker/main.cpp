@@ -10,10 +10,14 @@
 #include <QSharedPointer>
 #include <QStringListModel>
 #include <QtGlobal>
+#include <QAccessible>
+#include <QVBoxLayout>
 
 // QtMWidgets include.
 #include <QtMWidgets/Picker>
 
+#include <QtMWidgets/private/idlescheduler.hpp>
+
 class StringListEvenDisabledModel
 	:	public QStringListModel
 {
@@ -208,6 +212,94 @@ private slots:
 		m_picker->setModel( &m_model );
 	}
 
+	void testRange()
+	{
+		m_picker->setRange( 0.0, 100000.0, 0.5 );
+
+		QVERIFY( m_picker->isRangeMode() );
+		QVERIFY( m_picker->count() == 200001 );
+		QVERIFY( m_picker->currentIndex() == 0 );
+		QVERIFY( m_picker->itemText( 1 ) == QStringLiteral( "0.5" ) );
+		QVERIFY( qFuzzyCompare( m_picker->itemValue( 3 ), 1.5 ) );
+
+		m_picker->setCurrentValue( 250.5 );
+
+		QVERIFY( m_picker->currentIndex() == 501 );
+		QVERIFY( m_picker->currentText() == QStringLiteral( "250.5" ) );
+		QVERIFY( qFuzzyCompare( m_picker->currentValue(), 250.5 ) );
+
+		m_picker->setCurrentValue( 1000000.0 );
+
+		QVERIFY( m_picker->currentIndex() == 200000 );
+
+		m_picker->setRangeFormatter( []( qreal v )
+			{ return QString::number( v, 'f', 2 ) + QStringLiteral( " kg" ); } );
+
+		QVERIFY( m_picker->currentText() == QStringLiteral( "100000.00 kg" ) );
+
+		m_picker->setModel( &m_model );
+
+		QVERIFY( !m_picker->isRangeMode() );
+		QVERIFY( m_picker->count() == m_model.rowCount() );
+	}
+
+	void testRangeWidth()
+	{
+		QtMWidgets::Picker picker;
+		const QFontMetrics fm = picker.fontMetrics();
+		const QString longText = QStringLiteral( "very long middle value" );
+
+		// Small range measures all formatted values.
+		picker.setRange( 0.0, 10.0, 1.0 );
+		picker.setRangeFormatter( [longText] ( qreal v )
+			{ return ( v == 5.0 ? longText : QString::number( v ) ); } );
+
+		QVERIFY( picker.sizeHint().width() > fm.boundingRect( longText ).width() );
+
+		// Large range reserves the widest digits.
+		picker.setRangeFormatter( QtMWidgets::Picker::RangeFormatter() );
+		picker.setRange( 0.0, 100000.0, 1.0 );
+
+		int digit = 0;
+
+		for( char c = '0'; c <= '9'; ++c )
+			digit = qMax( digit, fm.horizontalAdvance( QLatin1Char( c ) ) );
+
+		QVERIFY( picker.sizeHint().width() >= digit * 6 );
+	}
+
+	void testAccessibility()
+	{
+		QtMWidgets::Picker picker;
+		picker.setRange( 0.0, 100000.0, 1.0 );
+		picker.setCurrentIndex( 500 );
+
+		picker.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &picker ) );
+
+		QAccessibleInterface * iface =
+			QAccessible::queryAccessibleInterface( &picker );
+
+		QVERIFY( iface );
+		QVERIFY( iface->tableInterface() );
+		QVERIFY( iface->tableInterface()->rowCount() == 100001 );
+		QVERIFY( iface->childCount() > 0 );
+		QVERIFY( iface->childCount() < 10 );
+		QVERIFY( iface->text( QAccessible::Value ) ==
+			QStringLiteral( "500" ) );
+		QVERIFY( iface->tableInterface()->isRowSelected( 500 ) );
+
+		QAccessibleInterface * row = iface->tableInterface()->cellAt( 700, 0 );
+
+		QVERIFY( row );
+		QVERIFY( row->text( QAccessible::Name ) == QStringLiteral( "700" ) );
+
+		QVERIFY( iface->tableInterface()->selectRow( 700 ) );
+		QVERIFY( picker.currentIndex() == 700 );
+		QVERIFY( row->state().selected );
+	}
+
 	void testThreeItems()
 	{
 		QStringList data;
@@ -222,6 +314,127 @@ private slots:
 		QTest::qWait( 1000 );
 	}
 
+	void testIdleScheduler()
+	{
+		class CountJob
+			:	public QtMWidgets::IdleJob
+		{
+		public:
+			CountJob( int c, QStringList & l, const char * n,
+				Priority p = NormalPriority )
+				:	QtMWidgets::IdleJob( n, p )
+				,	count( c )
+				,	log( l )
+			{
+			}
+
+		protected:
+			bool run( const QDeadlineTimer & ) override
+			{
+				log.append( QLatin1String( name() ) );
+
+				return ( --count <= 0 );
+			}
+
+		private:
+			int count;
+			QStringList & log;
+		};
+
+		QtMWidgets::IdleScheduler * scheduler =
+			QtMWidgets::IdleScheduler::instance();
+
+		QStringList log;
+		int hookCalls = 0;
+
+		scheduler->setStatsHook( [&hookCalls] ( const QtMWidgets::IdleJob * )
+			{ ++hookCalls; } );
+
+		CountJob low( 2, log, "low", QtMWidgets::IdleJob::LowPriority );
+		CountJob high( 2, log, "high", QtMWidgets::IdleJob::HighPriority );
+
+		scheduler->post( &low );
+		scheduler->post( &high );
+
+		QVERIFY( scheduler->pendingCount() == 2 );
+
+		QTRY_VERIFY( scheduler->pendingCount() == 0 );
+
+		QVERIFY( log == QStringList() << QStringLiteral( "high" )
+			<< QStringLiteral( "high" ) << QStringLiteral( "low" )
+			<< QStringLiteral( "low" ) );
+		QVERIFY( hookCalls == 4 );
+		QVERIFY( low.stats().finished && low.stats().slices == 2 );
+
+		{
+			CountJob sync( 3, log, "sync" );
+			scheduler->post( &sync );
+			scheduler->finish( &sync );
+
+			QVERIFY( !sync.isPending() );
+			QVERIFY( sync.stats().slices == 3 );
+
+			CountJob canceled( 3, log, "canceled" );
+			scheduler->post( &canceled );
+		}
+
+		QVERIFY( scheduler->pendingCount() == 0 );
+
+		scheduler->setStatsHook( QtMWidgets::IdleScheduler::StatsHook() );
+
+		QStringList data;
+
+		for( int i = 0; i < 20000; ++i )
+			data.append( QString::number( i ) );
+
+		data.append( QStringLiteral( "Very very very very very very very long line" ) );
+
+		QStringListModel model( data );
+		QWidget window;
+		QVBoxLayout * layout = new QVBoxLayout( &window );
+		QtMWidgets::Picker picker;
+		layout->addWidget( &picker );
+		picker.setModel( &model );
+
+		const int width = picker.sizeHint().width();
+
+		// Layout caches the size hint of the not yet measured picker.
+		QVERIFY( window.sizeHint().width() >= width );
+
+		QTRY_VERIFY( scheduler->pendingCount() == 0 );
+
+		QVERIFY( picker.sizeHint().width() >= width );
+		QVERIFY( picker.sizeHint().width() >
+			picker.fontMetrics().boundingRect( data.last() ).width() );
+
+		// Layout is notified when measuring is finished.
+		QVERIFY( window.sizeHint().width() >=
+			picker.sizeHint().width() );
+	}
+
+	void testMemoryUsage()
+	{
+		QtMWidgets::Picker picker;
+
+		const qint64 empty = picker.memoryUsage().bytes(
+			QtMWidgets::MemoryUsage::Data );
+
+		picker.addItems( m_data );
+
+		const QtMWidgets::MemoryUsage u = picker.memoryUsage();
+
+		QVERIFY( u.bytes( QtMWidgets::MemoryUsage::Data ) > empty );
+		QVERIFY( u.bytes( QtMWidgets::MemoryUsage::Caches ) > 0 );
+		QVERIFY( u.bytes( QtMWidgets::MemoryUsage::Animations ) > 0 );
+		QVERIFY( u.bytes( QtMWidgets::MemoryUsage::ChildWidgets ) == 0 );
+
+		// External model isn't owned by the picker.
+		picker.setModel( &m_model );
+
+		QVERIFY( picker.memoryUsage().bytes( QtMWidgets::MemoryUsage::Data ) ==
+			empty );
+	}
+
 private:
 	QStringList m_data;
 	QSharedPointer< QtMWidgets::Picker > m_picker;
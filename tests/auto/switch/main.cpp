@@ -11,6 +11,7 @@
 
 // QtMWidgets include.
 #include <QtMWidgets/Switch>
+#include <QtMWidgets/RenderingQuality>
 
 
 class TestSwitch
@@ -108,6 +109,59 @@ private slots:
 		QVERIFY( m_switch->isChecked() == false );
 	}
 
+	void testStyleTokens()
+	{
+		m_switch->setState( QtMWidgets::Switch::AcceptedCheck );
+
+		const QImage before = m_switch->grab().toImage();
+
+		QVERIFY( m_switch->grab().toImage() == before );
+
+		m_switch->setOnColor( Qt::red );
+
+		const QImage onColorChanged = m_switch->grab().toImage();
+
+		QVERIFY( onColorChanged != before );
+
+		QPalette palette = m_switch->palette();
+		palette.setColor( QPalette::Shadow, Qt::green );
+		m_switch->setPalette( palette );
+
+		QVERIFY( m_switch->grab().toImage() != onColorChanged );
+	}
+
+	void testRenderingQuality()
+	{
+		QVERIFY( QtMWidgets::RenderingQuality::level() ==
+			QtMWidgets::RenderingQuality::Full );
+
+		QSignalSpy spy( QtMWidgets::RenderingQuality::instance(),
+			&QtMWidgets::RenderingQuality::levelChanged );
+
+		const QImage full = m_switch->grab().toImage();
+
+		QtMWidgets::RenderingQuality::setLevel(
+			QtMWidgets::RenderingQuality::Minimal );
+
+		QVERIFY( spy.count() == 1 );
+		QVERIFY( !QtMWidgets::RenderingQuality::antialiasing() );
+		QVERIFY( !QtMWidgets::RenderingQuality::decorations() );
+
+		QVERIFY( m_switch->grab().toImage() != full );
+
+		QtMWidgets::RenderingQuality::setLevel(
+			QtMWidgets::RenderingQuality::Minimal );
+
+		QVERIFY( spy.count() == 1 );
+
+		QtMWidgets::RenderingQuality::setLevel(
+			QtMWidgets::RenderingQuality::Full );
+
+		QVERIFY( spy.count() == 2 );
+
+		QVERIFY( m_switch->grab().toImage() == full );
+	}
+
 private:
 	QSharedPointer< QtMWidgets::Switch > m_switch;
 	QFont m_font;
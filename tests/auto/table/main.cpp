@@ -15,6 +15,10 @@
 #include <QtMWidgets/TextLabel>
 #include <QtMWidgets/Slider>
 #include <QtMWidgets/Switch>
+#include <QtMWidgets/CacheRegistry>
+
+#include <QtMWidgets/private/textlayoutcache.hpp>
+#include <QtMWidgets/private/lrucache.hpp>
 
 
 class TestTable
@@ -142,6 +146,205 @@ private slots:
 		QTest::qWait( 50 );
 	}
 
+	void testTextLayoutCache()
+	{
+		QtMWidgets::TextLayoutCache & cache =
+			QtMWidgets::TextLayoutCache::instance();
+		cache.clear();
+
+		QtMWidgets::TextLabel l1( QLatin1String( "km/h" ) );
+		QtMWidgets::TextLabel l2( QLatin1String( "km/h" ) );
+
+		const int h = l1.heightForWidth( 100 );
+
+		QVERIFY( cache.misses() == 1 );
+		QVERIFY( l2.heightForWidth( 100 ) == h );
+		QVERIFY( cache.hits() == 1 );
+		QVERIFY( cache.count() == 1 );
+
+		const QtMWidgets::TextLayoutKey key( QLatin1String( "km/h" ),
+			Qt::AutoText, l1.font(), l1.textOption(), 50.0 );
+
+		const QStaticText t1 = cache.staticText( key );
+		const QStaticText t2 = cache.staticText( key );
+
+		QVERIFY( t1 == t2 );
+		QVERIFY( cache.count() == 2 );
+		QVERIFY( cache.usedBytes() <= cache.maxBytes() );
+
+		cache.setMaxBytes( 0 );
+
+		QVERIFY( cache.count() == 0 );
+		QVERIFY( l1.heightForWidth( 100 ) == h );
+		QVERIFY( cache.count() == 0 );
+
+		cache.setMaxBytes( 2 * 1024 * 1024 );
+	}
+
+	void testCacheRegistry()
+	{
+		const qint64 budget = QtMWidgets::CacheRegistry::maxBytes();
+
+		QtMWidgets::TextLayoutCache::instance().clear();
+		QtMWidgets::CacheRegistry::setMaxBytes( 1000 );
+
+		QtMWidgets::LruCache< int, int > rows( QLatin1String( "Rows" ), 1000 );
+		QtMWidgets::LruCache< int, int > sprites( QLatin1String( "Sprites" ),
+			1000, 2 );
+
+		QVERIFY( sprites.insert( 1, new int( 1 ), 500 ) );
+
+		for( int i = 1; i <= 4; ++i )
+			QVERIFY( rows.insert( i, new int( i ), 100 ) );
+
+		QVERIFY( QtMWidgets::CacheRegistry::usedBytes() == 900 );
+
+		// Sprite is older, but it's twice more valuable.
+		QVERIFY( rows.insert( 5, new int( 5 ), 200 ) );
+		QVERIFY( sprites.contains( 1 ) );
+		QVERIFY( !rows.contains( 1 ) );
+		QVERIFY( rows.contains( 2 ) );
+		QVERIFY( QtMWidgets::CacheRegistry::usedBytes() == 1000 );
+
+		QVERIFY( rows.object( 2 ) != 0 );
+		QVERIFY( rows.object( 1 ) == 0 );
+		QVERIFY( !rows.insert( 6, new int( 6 ), 2000 ) );
+
+		bool found = false;
+
+		foreach( const QtMWidgets::CacheStatistics & s,
+			QtMWidgets::CacheRegistry::statistics() )
+		{
+			if( s.name == QLatin1String( "Rows" ) )
+			{
+				found = true;
+
+				QVERIFY( s.count == 4 );
+				QVERIFY( s.usedBytes == 500 );
+				QVERIFY( s.hits == 1 );
+				QVERIFY( s.misses == 1 );
+				QVERIFY( qFuzzyCompare( s.hitRate(), 0.5 ) );
+			}
+		}
+
+		QVERIFY( found );
+
+		QtMWidgets::CacheRegistry::instance()->trim(
+			QtMWidgets::CacheRegistry::TrimModerate );
+
+		QVERIFY( QtMWidgets::CacheRegistry::usedBytes() <= 500 );
+
+		QtMWidgets::CacheRegistry::instance()->trim(
+			QtMWidgets::CacheRegistry::TrimComplete );
+
+		QVERIFY( QtMWidgets::CacheRegistry::usedBytes() == 0 );
+
+		QtMWidgets::CacheRegistry::setMaxBytes( budget );
+	}
+
+	void testSeparators()
+	{
+		QtMWidgets::TableView view;
+		QtMWidgets::TableViewSection * section =
+			new QtMWidgets::TableViewSection( &view );
+		view.addSection( section );
+
+		for( int i = 0; i < 3; ++i )
+		{
+			QtMWidgets::TableViewCell * cell =
+				new QtMWidgets::TableViewCell( section );
+			cell->textLabel()->setText( QString::number( i ) );
+			section->addCell( cell );
+		}
+
+		view.resize( 200, 400 );
+		view.show();
+
+		QVERIFY( QTest::qWaitForWindowExposed( &view ) );
+
+		QVERIFY( section->findChildren< QWidget* >(
+			QString(), Qt::FindDirectChildrenOnly ).size() == 5 );
+
+		QVERIFY( section->cellAt( 1 )->geometry().top() ==
+			section->cellAt( 0 )->geometry().bottom() + 2 );
+		QVERIFY( section->cellAt( 2 )->geometry().top() ==
+			section->cellAt( 1 )->geometry().bottom() + 2 );
+
+		delete section->removeCell( 1 );
+
+		QTRY_VERIFY( section->cellAt( 1 )->geometry().top() ==
+			section->cellAt( 0 )->geometry().bottom() + 2 );
+	}
+
+	void testPopulate()
+	{
+		QtMWidgets::TableView view;
+		QtMWidgets::TableViewSection * section =
+			new QtMWidgets::TableViewSection( &view );
+		view.addSection( section );
+
+		QSignalSpy spy( section, &QtMWidgets::TableViewSection::populated );
+
+		section->setPopulationSliceDuration( 1 );
+
+		QVERIFY( section->populationSliceDuration() == 1 );
+
+		int created = 0;
+
+		section->populate( 500,
+			[&created] ( int index, QtMWidgets::TableViewSection * s )
+			{
+				QtMWidgets::TableViewCell * cell = new QtMWidgets::TableViewCell( s );
+				cell->textLabel()->setText( QString::number( index ) );
+				++created;
+
+				return cell;
+			} );
+
+		QVERIFY( section->cellsCount() > 0 );
+		QVERIFY( section->cellsCount() + section->pendingCellsCount() == 500 );
+
+		QTRY_VERIFY( spy.count() == 1 );
+
+		QVERIFY( !section->isPopulating() );
+		QVERIFY( section->cellsCount() == 500 );
+		QVERIFY( created == 500 );
+		QVERIFY( section->cellAt( 499 )->textLabel()->text() ==
+			QLatin1String( "499" ) );
+
+		section->populate( 1000,
+			[] ( int, QtMWidgets::TableViewSection * s )
+			{ return new QtMWidgets::TableViewCell( s ); } );
+
+		section->cancelPopulation();
+
+		QVERIFY( !section->isPopulating() );
+		QVERIFY( section->pendingCellsCount() == 0 );
+		QVERIFY( section->cellsCount() < 1500 );
+	}
+
+	void testMemoryUsage()
+	{
+		QtMWidgets::TableView view;
+		QtMWidgets::TableViewSection * section =
+			new QtMWidgets::TableViewSection( &view );
+		view.addSection( section );
+
+		const qint64 emptySection = section->memoryUsage().total();
+
+		for( int i = 0; i < 10; ++i )
+			section->addCell( new QtMWidgets::TableViewCell( section ) );
+
+		QVERIFY( section->memoryUsage().total() > emptySection );
+		QVERIFY( view.memoryUsage().total() >
+			QtMWidgets::ScrollArea().memoryUsage().total() );
+		QVERIFY( QtMWidgets::MemoryUsage::ofWidget( section ).total() ==
+			section->memoryUsage().total() );
+		QVERIFY( QtMWidgets::MemoryUsage::ofTree( &view ).bytes(
+			QtMWidgets::MemoryUsage::ChildWidgets ) >=
+				section->memoryUsage().total() );
+	}
+
 private:
 	QSharedPointer< QtMWidgets::TableView > m_v;
 	QtMWidgets::TableViewSection * m_ringerAndAlerts;